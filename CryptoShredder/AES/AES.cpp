@@ -848,29 +848,7 @@ const vector<unsigned char> AES::Decrypt_OFB(vector<unsigned char>& text, const
  * @throws  invalid_argument thrown if given iv is invalid.
  */
 const vector<unsigned char> AES::Encrypt_CTR(vector<unsigned char>& text, const vector<unsigned char>& key, const vector<unsigned char>& iv) {
-    SetOperationMode(key.size()); //call our SetOperationMode function to check the key and set correct AES mode, throws invalid argument if key invalid
-    if (text.empty()) //if plaintext is empty
-        throw invalid_argument("Invalid mode of operation, please provide valid plaintext that matches AES CTR requirements."); //throw invalid argument
-    if (iv.size() != BlockSize) //if IV vector isn't in correct size
-        throw invalid_argument("Invalid mode of operation, please provide valid initialization vector that matches AES CTR requirements."); //throw invalid argument
-    vector<vector<unsigned char>> roundKeys = KeySchedule(key); //call our KeySchedule function for generating round keys
-    vector<unsigned char> previousIV = iv; //initialize previousIV vector with IV vector
-    vector<unsigned char> currentIV(BlockSize); //initialize currentIV vector
-    for (size_t i = 0, j = 0; i < text.size(); i++) { //iterate over text
-        if (j % BlockSize == 0) { //if we are in new cipher block we encrypt currentIV
-            currentIV = previousIV; //set currentIV vector to previousIV vector for encryption
-            EncryptBlock(currentIV.data(), roundKeys); //encrypt the block using our AES EncryptBlock function using round keys
-            j = 0; //set the index for IV vector back to zero to perform XOR operation 
-        }
-        text[i] ^= currentIV[j]; //perform byte XOR between text and IV vector
-        j++; //increase j index for IV vector
-        //here we increase the counter for IV vector
-        if (j == BlockSize) { //if j equals to block size 
-            for (size_t k = BlockSize - 1; k >= BlockSize / 2; k--) //iterate over previousIV 
-                if (++previousIV[k]) break; //increment previousIV[k] and break if it's not zero
-        }
-    }
-    ClearVector(roundKeys); //clear our roundKeys for added security after we finish operations
+    Apply_CTR(text.data(), text.size(), key, iv); //call our Apply_CTR function to encrypt the text in place, throws invalid argument if parameters invalid
     return text; //return ciphered text
 }
 
@@ -888,18 +866,36 @@ const vector<unsigned char> AES::Encrypt_CTR(vector<unsigned char>& text, const
  * @throws  invalid_argument thrown if given iv is invalid.
  */
 const vector<unsigned char> AES::Decrypt_CTR(vector<unsigned char>& text, const vector<unsigned char>& key, const vector<unsigned char>& iv) {
+    Apply_CTR(text.data(), text.size(), key, iv); //call our Apply_CTR function to decrypt the text in place, throws invalid argument if parameters invalid
+    return text; //return deciphered text
+}
+
+
+/**
+ * @brief  Function that applies AES CTR mode keystream in place on given memory using specified key and initialization vector.
+ * @brief  CTR mode supports AES-128, AES-192 and AES-256, encryption and decryption are the same operation.
+ * @brief  Supports text in any size, used for memory that isn't owned by a vector such as mapped file views.
+ * @param  unsigned char* text
+ * @param  size_t textSize
+ * @param  vector<unsigned char> key
+ * @param  vector<unsigned char> iv
+ * @throws  invalid_argument thrown if given text is invalid.
+ * @throws  invalid_argument thrown if given key is invalid.
+ * @throws  invalid_argument thrown if given iv is invalid.
+ */
+void AES::Apply_CTR(unsigned char* text, const size_t textSize, const vector<unsigned char>& key, const vector<unsigned char>& iv) {
     SetOperationMode(key.size()); //call our SetOperationMode function to check the key and set correct AES mode, throws invalid argument if key invalid
-    if (text.empty()) //if plaintext is empty
+    if (text == NULL || textSize == 0) //if text is empty
         throw invalid_argument("Invalid mode of operation, please provide valid plaintext that matches AES CTR requirements."); //throw invalid argument
     if (iv.size() != BlockSize) //if IV vector isn't in correct size
         throw invalid_argument("Invalid mode of operation, please provide valid initialization vector that matches AES CTR requirements."); //throw invalid argument
     vector<vector<unsigned char>> roundKeys = KeySchedule(key); //call our KeySchedule function for generating round keys
     vector<unsigned char> previousIV = iv; //initialize previousIV vector with IV vector
     vector<unsigned char> currentIV(BlockSize); //initialize currentIV vector
-    for (size_t i = 0, j = 0; i < text.size(); i++) { //iterate over text
+    for (size_t i = 0, j = 0; i < textSize; i++) { //iterate over text
         if (j % BlockSize == 0) { //if we are in new cipher block we encrypt currentIV
-            currentIV = previousIV; //set currentIV vector to previousIV vector for decryption
-            EncryptBlock(currentIV.data(), roundKeys); //decrypt the block using our AES EncryptBlock function using round keys
+            currentIV = previousIV; //set currentIV vector to previousIV vector for encryption
+            EncryptBlock(currentIV.data(), roundKeys); //encrypt the block using our AES EncryptBlock function using round keys
             j = 0; //set the index for IV vector back to zero to perform XOR operation 
         }
         text[i] ^= currentIV[j]; //perform byte XOR between text and IV vector
@@ -911,5 +907,43 @@ const vector<unsigned char> AES::Decrypt_CTR(vector<unsigned char>& text, const
         }
     }
     ClearVector(roundKeys); //clear our roundKeys for added security after we finish operations
-    return text; //return deciphered text
+}
+
+
+/**
+ * @brief  Function that creates AES CTR mode keystream of given size using specified key and initialization vector.
+ * @brief  The keystream doesn't depend on the text, so it can be created before the text is available.
+ * @param  size_t keystreamSize
+ * @param  vector<unsigned char> key
+ * @param  vector<unsigned char> iv
+ * @return  vector<unsigned char> keystream
+ * @throws  invalid_argument thrown if given key is invalid.
+ * @throws  invalid_argument thrown if given iv is invalid.
+ */
+const vector<unsigned char> AES::Create_Keystream(const size_t keystreamSize, const vector<unsigned char>& key, const vector<unsigned char>& iv) {
+    vector<unsigned char> keystream(keystreamSize, 0); //create zeroed vector, applying CTR on zeros gives the keystream itself
+    Apply_CTR(keystream.data(), keystream.size(), key, iv); //call our Apply_CTR function to fill the keystream, throws invalid argument if parameters invalid
+    return keystream; //return the keystream
+}
+
+
+/**
+ * @brief  Function that applies precomputed keystream in place on given text with vectorized XOR.
+ * @param  unsigned char* text
+ * @param  unsigned char* keystream
+ * @param  size_t textSize
+ */
+void AES::Apply_Keystream(unsigned char* text, const unsigned char* keystream, const size_t textSize) {
+    size_t i = 0; //represents the current index in text
+#if defined(_M_X64) || defined(__SSE2__)
+    for (; i + 64 <= textSize; i += 64) { //XOR 64 bytes in each iteration with SSE2 registers
+        for (size_t j = 0; j < 64; j += 16) {
+            __m128i textBlock = _mm_loadu_si128((const __m128i*)(text + i + j)); //load 16 bytes of text
+            __m128i keyBlock = _mm_loadu_si128((const __m128i*)(keystream + i + j)); //load 16 bytes of keystream
+            _mm_storeu_si128((__m128i*)(text + i + j), _mm_xor_si128(textBlock, keyBlock)); //store XOR result back in text
+        }
+    }
+#endif
+    for (; i < textSize; i++) //XOR the remaining bytes
+        text[i] ^= keystream[i]; //perform byte XOR between text and keystream
 }
\ No newline at end of file
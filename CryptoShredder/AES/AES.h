@@ -8,6 +8,9 @@
 #include <fstream>
 #include <cstdlib>
 #include <iomanip> 
+#if defined(_M_X64) || defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 
 using namespace std;
 
@@ -302,6 +305,40 @@ public:
 	 */
 	static const vector<unsigned char> Decrypt_CTR(vector<unsigned char>& text, const vector<unsigned char>& key, const vector<unsigned char>& iv);
 
+	/**
+	 * @brief  Function that applies AES CTR mode keystream in place on given memory using specified key and initialization vector.
+	 * @brief  CTR mode supports AES-128, AES-192 and AES-256, encryption and decryption are the same operation.
+	 * @brief  Supports text in any size, used for memory that isn't owned by a vector such as mapped file views.
+	 * @param  unsigned char* text
+	 * @param  size_t textSize
+	 * @param  vector<unsigned char> key
+	 * @param  vector<unsigned char> iv
+	 * @throws  invalid_argument thrown if given text is invalid.
+	 * @throws  invalid_argument thrown if given key is invalid.
+	 * @throws  invalid_argument thrown if given iv is invalid.
+	 */
+	static void Apply_CTR(unsigned char* text, const size_t textSize, const vector<unsigned char>& key, const vector<unsigned char>& iv);
+
+	/**
+	 * @brief  Function that creates AES CTR mode keystream of given size using specified key and initialization vector.
+	 * @brief  The keystream doesn't depend on the text, so it can be created before the text is available.
+	 * @param  size_t keystreamSize
+	 * @param  vector<unsigned char> key
+	 * @param  vector<unsigned char> iv
+	 * @return  vector<unsigned char> keystream
+	 * @throws  invalid_argument thrown if given key is invalid.
+	 * @throws  invalid_argument thrown if given iv is invalid.
+	 */
+	static const vector<unsigned char> Create_Keystream(const size_t keystreamSize, const vector<unsigned char>& key, const vector<unsigned char>& iv);
+
+	/**
+	 * @brief  Function that applies precomputed keystream in place on given text with vectorized XOR.
+	 * @param  unsigned char* text
+	 * @param  unsigned char* keystream
+	 * @param  size_t textSize
+	 */
+	static void Apply_Keystream(unsigned char* text, const unsigned char* keystream, const size_t textSize);
+
 	/**
 	 * @brief  Function for creating a vector.
 	 * @param  size_t vecSize
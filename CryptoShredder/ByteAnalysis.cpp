@@ -0,0 +1,263 @@
+#include "ByteAnalysis.h"
+#include <cmath>
+
+
+/**
+ * @brief Constructor for byte analysis.
+ * @param size_t numOfThreads
+ */
+ByteAnalysis::ByteAnalysis(size_t numOfThreads) : numOfThreads(max(numOfThreads, (size_t)1)) {}
+
+
+/**
+ * @brief Destructor for byte analysis, stops the tasks and waits for them.
+ */
+ByteAnalysis::~ByteAnalysis() {
+	this->stop(); //stop the tasks and wait for them
+}
+
+
+/**
+ * @brief Function for counting the byte values of data and adding them to counts, counts must hold 256 values.
+ * @brief Bytes are read 8 at a time and counted into four tables, so runs of the same byte don't wait on the increment of one counter.
+ * @param unsigned char* data
+ * @param size_t length
+ * @param uint32_t* counts
+ */
+void ByteAnalysis::Histogram(const unsigned char* data, size_t length, uint32_t* counts) {
+	uint32_t tables[4][256] = {}; //represents the four tables of counts
+	size_t i = 0; //represents the position in data
+	for (; i + 16 <= length; i += 16) { //count two words of 8 bytes at a time
+		uint64_t first, second; //represents the words, each table gets a byte of both words in turn
+		memcpy(&first, data + i, sizeof(first));
+		memcpy(&second, data + i + 8, sizeof(second));
+		tables[0][(unsigned char)first]++;
+		tables[1][(unsigned char)second]++;
+		tables[2][(unsigned char)(first >> 8)]++;
+		tables[3][(unsigned char)(second >> 8)]++;
+		tables[0][(unsigned char)(first >> 16)]++;
+		tables[1][(unsigned char)(second >> 16)]++;
+		tables[2][(unsigned char)(first >> 24)]++;
+		tables[3][(unsigned char)(second >> 24)]++;
+		tables[0][(unsigned char)(first >> 32)]++;
+		tables[1][(unsigned char)(second >> 32)]++;
+		tables[2][(unsigned char)(first >> 40)]++;
+		tables[3][(unsigned char)(second >> 40)]++;
+		tables[0][(unsigned char)(first >> 48)]++;
+		tables[1][(unsigned char)(second >> 48)]++;
+		tables[2][(unsigned char)(first >> 56)]++;
+		tables[3][(unsigned char)(second >> 56)]++;
+	}
+	for (; i < length; i++) //count the bytes that are left
+		tables[0][data[i]]++;
+	for (size_t value = 0; value < 256; value++) //add the tables to counts
+		counts[value] += tables[0][value] + tables[1][value] + tables[2][value] + tables[3][value];
+}
+
+
+/**
+ * @brief Function for calculating the Shannon entropy of byte counts in bits per byte, from 0 for a single value to 8 for uniform bytes.
+ * @param uint64_t* counts
+ * @param uint64_t total
+ */
+double ByteAnalysis::Entropy(const uint64_t* counts, uint64_t total) {
+	if (total == 0) //if true there are no bytes
+		return 0;
+	double sum = 0; //represents the sum of count * log2(count)
+	for (size_t value = 0; value < 256; value++)
+		if (counts[value] > 0)
+			sum += (double)counts[value] * log2((double)counts[value]);
+	return max(log2((double)total) - sum / (double)total, 0.0); //entropy is log2(total) - sum / total
+}
+
+
+/**
+ * @brief Function for calculating the chi-square statistic of byte counts against uniform bytes, random bytes give about 255.
+ * @param uint64_t* counts
+ * @param uint64_t total
+ */
+double ByteAnalysis::ChiSquare(const uint64_t* counts, uint64_t total) {
+	if (total == 0) //if true there are no bytes
+		return 0;
+	double expected = (double)total / 256; //represents the expected count of each value
+	double sum = 0; //represents the chi-square statistic
+	for (size_t value = 0; value < 256; value++) {
+		double difference = (double)counts[value] - expected;
+		sum += difference * difference / expected;
+	}
+	return sum;
+}
+
+
+/**
+ * @brief Function for calculating the probability that uniform random bytes give a chi-square statistic this high or higher.
+ * @brief Uses the Wilson-Hilferty approximation for 255 degrees of freedom, values near 0 or 1 show that bytes aren't random.
+ * @param double chiSquare
+ */
+double ByteAnalysis::ChiSquareProbability(double chiSquare) {
+	const double freedom = 255; //represents the degrees of freedom of 256 byte values
+	double variance = 2 / (9 * freedom); //represents the variance of cube root of chi-square divided by freedom
+	double z = (cbrt(chiSquare / freedom) - (1 - variance)) / sqrt(variance); //represents the normal deviate of statistic
+	return 0.5 * erfc(z / sqrt(2.0)); //upper tail of normal distribution
+}
+
+
+/**
+ * @brief Function for downsampling windows to columns of strip chart, each column gets the mean entropy and the lowest block entropy of its windows.
+ * @brief Columns of windows that weren't analyzed yet are not done, when there are fewer windows than columns each window spans several columns.
+ * @param vector<AnalysisWindow> windows
+ * @param size_t columns
+ * @param vector<AnalysisWindow> strip
+ */
+void ByteAnalysis::Downsample(const vector<AnalysisWindow>& windows, size_t columns, vector<AnalysisWindow>& strip) {
+	strip.assign(windows.empty() ? 0 : columns, AnalysisWindow()); //represents the columns of chart
+	for (size_t column = 0; column < strip.size(); column++) { //merge the windows of each column
+		size_t first = column * windows.size() / columns; //represents the first window of column
+		size_t last = max((column + 1) * windows.size() / columns, first + 1); //represents the window after the last window of column
+		double sum = 0; //represents the sum of entropy of analyzed windows
+		size_t count = 0; //represents the amount of analyzed windows
+		for (size_t window = first; window < last; window++) {
+			if (!windows[window].isDone) //if true window wasn't analyzed yet
+				continue;
+			if (count == 0 || windows[window].minEntropy < strip[column].minEntropy) { //if true window has the lowest block of column
+				strip[column].minEntropy = windows[window].minEntropy;
+				strip[column].minOffset = windows[window].minOffset;
+			}
+			sum += windows[window].entropy;
+			count++;
+		}
+		strip[column].isDone = count > 0;
+		strip[column].entropy = (count > 0) ? (float)(sum / count) : 0;
+	}
+}
+
+
+/**
+ * @brief Method for splitting the file into windows and starting the tasks that analyze them, returns false if the file couldn't be opened.
+ * @param path filePath
+ */
+bool ByteAnalysis::start(const filesystem::path& filePath) {
+	MappedFile file; //represents the file, opened only for its size
+	if (!file.open(filePath, true)) //if true we can't analyze the file
+		return false;
+	this->filePath = filePath; //save the path for tasks
+	this->fileSize = file.size(); //save the file size
+	file.close();
+
+	size_t minWindowSize = (this->fileSize + ByteAnalysis::MaxWindows - 1) / ByteAnalysis::MaxWindows; //represents the smallest window size for MaxWindows windows
+	this->windowSize = max(ByteAnalysis::BlockSize, (minWindowSize + ByteAnalysis::BlockSize - 1) / ByteAnalysis::BlockSize * ByteAnalysis::BlockSize); //windows hold whole blocks
+	size_t numOfWindows = (this->fileSize > 0) ? max(this->fileSize / this->windowSize, (size_t)1) : 0; //bytes after the last full window belong to last window
+	this->windows.assign(numOfWindows, AnalysisWindow()); //initialize the windows as not analyzed
+	if (numOfWindows == 0) { //if true the file is empty
+		this->isFinished.store(true);
+		return true;
+	}
+
+	size_t windowsPerChunk = max(ByteAnalysis::ChunkSize / this->windowSize, (size_t)1); //represents the amount of windows of each task
+	size_t numOfTasks = (numOfWindows + windowsPerChunk - 1) / windowsPerChunk; //represents the amount of tasks
+	this->pendingTasks.store(numOfTasks); //set before submitting so no task finishes the analysis early
+	this->threadPool = make_unique<ThreadPool>(min(this->numOfThreads, numOfTasks)); //create the pool, small files need fewer threads
+	for (size_t first = 0; first < numOfWindows; first += windowsPerChunk) { //submit a task for each chunk of windows
+		size_t last = min(first + windowsPerChunk, numOfWindows); //represents the window after the last window of chunk
+		this->threadPool->submit([this, first, last] { this->analyzeChunk(first, last); });
+	}
+	return true;
+}
+
+
+/**
+ * @brief Method for stopping the tasks and waiting for them, windows analyzed so far stay available.
+ */
+void ByteAnalysis::stop() {
+	this->isStopped.store(true); //tell the tasks to stop after current window
+	if (this->threadPool != NULL) //if true tasks were started
+		this->threadPool->shutdown(); //wait for tasks, queued tasks return at once
+}
+
+
+/**
+ * @brief Method for copying the results of windows, windows that weren't analyzed yet are not done.
+ * @param vector<AnalysisWindow> windows
+ */
+void ByteAnalysis::getWindows(vector<AnalysisWindow>& windows) {
+	lock_guard<mutex> lock(this->resultMutex); //lock the mutex of results
+	windows = this->windows;
+}
+
+
+/**
+ * @brief Method for copying the byte histogram of chunks that finished, 256 counts.
+ * @param vector<uint64_t> histogram
+ */
+void ByteAnalysis::getHistogram(vector<uint64_t>& histogram) {
+	lock_guard<mutex> lock(this->resultMutex); //lock the mutex of results
+	histogram.assign(this->histogram, this->histogram + 256);
+}
+
+
+/**
+ * @brief Method for getting the end offset of window, last window ends at end of file.
+ * @param size_t window
+ */
+size_t ByteAnalysis::getWindowEnd(size_t window) const {
+	return (window + 1 == this->windows.size()) ? this->fileSize : (window + 1) * this->windowSize;
+}
+
+
+/**
+ * @brief Method for analyzing a chunk of windows, runs on a thread of pool. The chunk is mapped with its own mapping so tasks don't share a window.
+ * @brief Each block is counted once, its counts give the block entropy and are added to the counts of its window and chunk.
+ * @param size_t firstWindow
+ * @param size_t lastWindow
+ */
+void ByteAnalysis::analyzeChunk(size_t firstWindow, size_t lastWindow) {
+	size_t chunkStart = firstWindow * this->windowSize; //represents the offset of chunk
+	size_t chunkEnd = this->getWindowEnd(lastWindow - 1); //represents the end of chunk
+	MappedFile file; //represents the read-only mapping of chunk
+	const unsigned char* data = NULL; //represents the mapped bytes of chunk
+	if (!this->isStopped.load() && file.open(this->filePath, true)) { //if true we map the chunk
+		file.adviseSequential(); //we read the chunk once from start to end
+		data = file.map(chunkStart, chunkEnd - chunkStart);
+	}
+	if (data == NULL && !this->isStopped.load()) //if true we failed reading the chunk
+		this->isFailed.store(true);
+
+	uint64_t chunkCounts[256] = {}; //represents the counts of chunk
+	for (size_t window = firstWindow; window < lastWindow && data != NULL && !this->isStopped.load(); window++) { //analyze each window until stopped
+		size_t windowStart = window * this->windowSize; //represents the offset of window
+		size_t windowEnd = this->getWindowEnd(window); //represents the end of window
+		uint64_t windowCounts[256] = {}; //represents the counts of window
+		AnalysisWindow result; //represents the result of window
+		for (size_t block = windowStart; block < windowEnd;) { //count each block of window
+			size_t length = (windowEnd - block < 2 * ByteAnalysis::BlockSize) ? windowEnd - block : ByteAnalysis::BlockSize; //last block also holds the bytes after last full block
+			uint32_t blockCounts[256] = {}; //represents the counts of block
+			ByteAnalysis::Histogram(data + (block - chunkStart), length, blockCounts);
+			uint64_t counts[256]; //represents the counts of block for entropy
+			for (size_t value = 0; value < 256; value++) {
+				counts[value] = blockCounts[value];
+				windowCounts[value] += blockCounts[value];
+			}
+			double entropy = ByteAnalysis::Entropy(counts, length); //represents the entropy of block
+			if (block == windowStart || entropy < result.minEntropy) { //if true block has the lowest entropy of window
+				result.minEntropy = (float)entropy;
+				result.minOffset = block;
+			}
+			block += length;
+			this->bytesAnalyzed.fetch_add(length); //update the progress
+		}
+		result.entropy = (float)ByteAnalysis::Entropy(windowCounts, windowEnd - windowStart); //set the entropy of whole window
+		result.isDone = true;
+		for (size_t value = 0; value < 256; value++)
+			chunkCounts[value] += windowCounts[value];
+		lock_guard<mutex> lock(this->resultMutex); //lock the mutex of results
+		this->windows[window] = result; //save the result of window
+	}
+	{
+		lock_guard<mutex> lock(this->resultMutex); //lock the mutex of results
+		for (size_t value = 0; value < 256; value++) //add the counts of chunk to histogram of file
+			this->histogram[value] += chunkCounts[value];
+	}
+	file.close(); //unmap the chunk and close the file
+	if (this->pendingTasks.fetch_sub(1) == 1) //if true this was the last task
+		this->isFinished.store(true);
+}
\ No newline at end of file
@@ -0,0 +1,77 @@
+#ifndef _ByteAnalysis_H
+#define _ByteAnalysis_H
+#define _CRT_SECURE_NO_WARNINGS
+#include <iostream>
+#include <string.h>
+#include <vector>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <cstdint>
+#include "ThreadPool.h"
+#include "IO/MmapBackend.h"
+
+using namespace std;
+
+/**
+ * @brief Struct that represents the result of a window of file, or of a column of strip chart that covers several windows.
+ */
+struct AnalysisWindow {
+	float entropy = 0; //represents the entropy of window in bits per byte
+	float minEntropy = 0; //represents the lowest entropy of blocks of window in bits per byte
+	size_t minOffset = 0; //represents the offset of block with lowest entropy
+	bool isDone = false; //flag for indicating that window was analyzed
+};
+
+
+/**
+ * @brief Class that analyzes the bytes of a file in parallel, for checking that wiped or encrypted files have no low-entropy regions left.
+ * @brief The file is split into at most MaxWindows windows and each window gets its Shannon entropy and the lowest entropy of its blocks,
+ * @brief so a small region of plaintext shows even when windows of large files are many MB. The whole file gets a byte histogram and
+ * @brief a chi-square score against uniform bytes. Chunks of windows are analyzed by a thread pool, each task maps its chunk for reading.
+ */
+class ByteAnalysis {
+private:
+	filesystem::path filePath; //represents the path of file, each task opens its own mapping
+	size_t fileSize = 0; //represents the size of file
+	size_t windowSize = BlockSize; //represents the size of windows, last window also holds the bytes after the last full window
+	size_t numOfThreads = 1; //represents the amount of threads that analyze the chunks
+	unique_ptr<ThreadPool> threadPool; //pool of threads that analyze the chunks
+	vector<AnalysisWindow> windows; //represents the result of each window
+	uint64_t histogram[256] = {}; //represents the amount of each byte value in file
+	mutex resultMutex; //mutex for windows and histogram
+	atomic<size_t> pendingTasks = 0; //represents the amount of tasks that didn't finish yet
+	atomic<size_t> bytesAnalyzed = 0; //represents the amount of bytes analyzed
+	atomic<bool> isStopped = false; //flag for indicating that analysis was stopped
+	atomic<bool> isFinished = false; //flag for indicating that all tasks finished
+	atomic<bool> isFailed = false; //flag for indicating that a chunk of file couldn't be read
+	void analyzeChunk(size_t firstWindow, size_t lastWindow);
+	size_t getWindowEnd(size_t window) const;
+
+public:
+	static constexpr size_t BlockSize = 64 * 1024; //size of blocks whose entropy is checked, large enough for random bytes to reach almost 8 bits
+	static constexpr size_t MaxWindows = 4096; //maximal amount of windows, windows of large files hold more blocks
+	static constexpr size_t ChunkSize = 64 * 1024 * 1024; //amount of bytes analyzed by each task, chunks hold whole windows
+	static constexpr double LowEntropy = 7.5; //entropy in bits per byte below which a block is reported, random and encrypted blocks are near 8
+	ByteAnalysis(size_t numOfThreads = max(thread::hardware_concurrency(), 1u));
+	virtual ~ByteAnalysis();
+	ByteAnalysis(const ByteAnalysis&) = delete; //prevent copy
+	void operator=(const ByteAnalysis&) = delete; //prevent assignment
+	static void Histogram(const unsigned char* data, size_t length, uint32_t* counts);
+	static double Entropy(const uint64_t* counts, uint64_t total);
+	static double ChiSquare(const uint64_t* counts, uint64_t total);
+	static double ChiSquareProbability(double chiSquare);
+	static void Downsample(const vector<AnalysisWindow>& windows, size_t columns, vector<AnalysisWindow>& strip);
+	bool start(const filesystem::path& filePath);
+	void stop();
+	void getWindows(vector<AnalysisWindow>& windows);
+	void getHistogram(vector<uint64_t>& histogram);
+	size_t getFileSize() const { return this->fileSize; }
+	size_t getWindowSize() const { return this->windowSize; }
+	size_t getBytesAnalyzed() const { return this->bytesAnalyzed.load(); }
+	bool getIsFinished() const { return this->isFinished.load(); }
+	bool getIsStopped() const { return this->isStopped.load(); }
+	bool getIsFailed() const { return this->isFailed.load(); }
+};
+#endif
\ No newline at end of file
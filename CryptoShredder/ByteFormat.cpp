@@ -0,0 +1,416 @@
+#include "ByteFormat.h"
+
+static const char HexDigits[] = "0123456789ABCDEF"; //represents the HEX digits, also the lookup table of pshufb
+
+/**
+ * @brief Struct that represents the shuffle tables that spread the HEX digits of 16 bytes into the 48 characters "XX " of a row, 16 characters for each vector.
+ */
+struct HexTables {
+	unsigned char first[3][16]; //represents the index of each character in digits of bytes 0 to 7, 0x80 gives zero
+	unsigned char second[3][16]; //represents the index of each character in digits of bytes 8 to 15, 0x80 gives zero
+	unsigned char spaces[3][16]; //represents the space after the digits of each byte
+};
+
+/**
+ * @brief Struct that represents the tables that expand the bits of 8 bytes into the 72 characters "bbbbbbbb " of a row, 16 characters for each vector.
+ * @brief Second lane of each table is for AVX2 which formats the next row in upper lane, its indices point 8 bytes further.
+ */
+struct BinaryTables {
+	unsigned char index[5][32]; //represents the index of byte of each character, 0x80 for spaces
+	unsigned char bits[5][32]; //represents the bit of byte that each character shows, zero for spaces
+	unsigned char ones[5][32]; //represents the value added to '0' for set bits, zero for spaces
+	unsigned char base[5][32]; //represents the character of clear bits, '0' for bits and ' ' for spaces
+};
+
+
+/**
+ * @brief Function for building the HEX shuffle tables at compile time.
+ */
+static constexpr HexTables MakeHexTables() {
+	HexTables tables{};
+	for (size_t k = 0; k < 3 * ByteFormat::HexRowBytes; k++) { //fill the entry of each character of row
+		size_t byte = k / 3, digit = k % 3; //represents the byte of character and its position, third position is the space
+		tables.first[k / 16][k % 16] = (digit < 2 && byte < 8) ? (unsigned char)(2 * byte + digit) : 0x80;
+		tables.second[k / 16][k % 16] = (digit < 2 && byte >= 8) ? (unsigned char)(2 * (byte - 8) + digit) : 0x80;
+		tables.spaces[k / 16][k % 16] = (digit == 2) ? ' ' : 0;
+	}
+	return tables;
+}
+
+
+/**
+ * @brief Function for building the BINARY expansion tables at compile time.
+ */
+static constexpr BinaryTables MakeBinaryTables() {
+	BinaryTables tables{};
+	for (size_t lane = 0; lane < 2; lane++) { //second lane formats the next row
+		for (size_t k = 0; k < 80; k++) { //fill the entry of each character of five vectors, characters after 72 are never stored
+			size_t byte = k / 9, bit = k % 9; //represents the byte of character and its bit, ninth position is the space
+			bool isBit = bit < 8 && k < 9 * ByteFormat::BinaryRowBytes; //flag for indicating that character shows a bit
+			tables.index[k / 16][16 * lane + k % 16] = isBit ? (unsigned char)(byte + 8 * lane) : 0x80;
+			tables.bits[k / 16][16 * lane + k % 16] = isBit ? (unsigned char)(0x80 >> bit) : 0;
+			tables.ones[k / 16][16 * lane + k % 16] = isBit ? 1 : 0;
+			tables.base[k / 16][16 * lane + k % 16] = isBit ? '0' : ' ';
+		}
+	}
+	return tables;
+}
+
+
+/**
+ * @brief Struct that represents the shuffle table that orders the digits of offset from its highest digit, followed by the spaces of offset column.
+ */
+struct OffsetTables {
+	unsigned char index[16]; //represents the index of each character in digits of offset bytes, 0x80 for spaces
+	unsigned char spaces[16]; //represents the spaces after the digits
+};
+
+
+/**
+ * @brief Function for building the offset shuffle table at compile time.
+ */
+static constexpr OffsetTables MakeOffsetTables() {
+	OffsetTables tables{};
+	for (size_t k = 0; k < 16; k++) { //fill the entry of each character, characters after the two spaces are written over by the row
+		size_t byte = ByteFormat::OffsetDigits / 2 - 1 - k / 2; //represents the byte of offset of character, highest byte first
+		tables.index[k] = (k < ByteFormat::OffsetDigits) ? (unsigned char)(2 * byte + k % 2) : 0x80;
+		tables.spaces[k] = (k < ByteFormat::OffsetDigits) ? 0 : ' ';
+	}
+	return tables;
+}
+
+static constexpr HexTables HexShuffle = MakeHexTables(); //represents the shuffle tables of HEX rows
+static constexpr OffsetTables OffsetShuffle = MakeOffsetTables(); //represents the shuffle table of offset column
+static constexpr BinaryTables BinaryExpand = MakeBinaryTables(); //represents the expansion tables of BINARY rows
+
+
+/**
+ * @brief Function for writing the HEX offset of row and its two spaces, returns the end of written characters.
+ * @param size_t offset
+ * @param char16_t* out
+ */
+char16_t* ByteFormat::Offset(size_t offset, char16_t* out) {
+	for (size_t i = 0; i < ByteFormat::OffsetDigits; i++) //write the digits from the last one
+		out[ByteFormat::OffsetDigits - 1 - i] = HexDigits[(offset >> (4 * i)) & 0x0F];
+	out[ByteFormat::OffsetDigits] = ' ';
+	out[ByteFormat::OffsetDigits + 1] = ' ';
+	return out + ByteFormat::OffsetDigits + 2;
+}
+
+
+/**
+ * @brief Function for getting the size of buffer for HEX dump of given length, includes the new line of last row.
+ * @param size_t length
+ */
+size_t ByteFormat::HexDumpSize(size_t length) {
+	size_t remainder = length % ByteFormat::HexRowBytes; //represents the bytes of last partial row
+	return (length / ByteFormat::HexRowBytes) * ByteFormat::HexRowChars + (remainder > 0 ? ByteFormat::HexRowChars - ByteFormat::HexRowBytes + remainder : 0);
+}
+
+
+/**
+ * @brief Function for getting the size of buffer for BINARY dump of given length, includes the new line of last row.
+ * @param size_t length
+ */
+size_t ByteFormat::BinaryDumpSize(size_t length) {
+	size_t remainder = length % ByteFormat::BinaryRowBytes; //represents the bytes of last partial row
+	return (length / ByteFormat::BinaryRowBytes) * ByteFormat::BinaryRowChars + (remainder > 0 ? ByteFormat::OffsetDigits + 2 + 9 * remainder + 1 : 0);
+}
+
+
+/**
+ * @brief Function for writing a HEX row of up to 16 bytes without its new line, returns the end of written characters.
+ * @brief Missing bytes of last row are written as spaces so its ASCII column stays aligned.
+ * @param unsigned char* data
+ * @param size_t length
+ * @param size_t offset
+ * @param char16_t* out
+ */
+char16_t* ByteFormat::HexRow(const unsigned char* data, size_t length, size_t offset, char16_t* out) {
+	out = ByteFormat::Offset(offset, out); //write the offset of row
+	for (size_t i = 0; i < ByteFormat::HexRowBytes; i++, out += 3) { //write the digits of each byte and its space
+		out[0] = (i < length) ? HexDigits[data[i] >> 4] : ' ';
+		out[1] = (i < length) ? HexDigits[data[i] & 0x0F] : ' ';
+		out[2] = ' ';
+	}
+	*out++ = ' '; //separate the ASCII column
+	for (size_t i = 0; i < length; i++) //unprintable bytes are shown as dots
+		*out++ = (data[i] >= 0x20 && data[i] < 0x7F) ? (char16_t)data[i] : u'.';
+	return out;
+}
+
+
+/**
+ * @brief Function for writing a BINARY row of up to 8 bytes without its new line, returns the end of written characters.
+ * @param unsigned char* data
+ * @param size_t length
+ * @param size_t offset
+ * @param char16_t* out
+ */
+char16_t* ByteFormat::BinaryRow(const unsigned char* data, size_t length, size_t offset, char16_t* out) {
+	out = ByteFormat::Offset(offset, out); //write the offset of row
+	for (size_t i = 0; i < length; i++) { //write the bits of each byte from the highest one and its space
+		for (int bit = 7; bit >= 0; bit--)
+			*out++ = ((data[i] >> bit) & 1) ? u'1' : u'0';
+		*out++ = ' ';
+	}
+	return out;
+}
+
+
+/**
+ * @brief Function for writing the HEX dump of data, each row starts at offset of its first byte. Buffer must hold HexDumpSize(length) characters.
+ * @brief Returns the end of dump, the new line of last row is written after it.
+ * @param unsigned char* data
+ * @param size_t length
+ * @param size_t offset
+ * @param char16_t* out
+ */
+char16_t* ByteFormat::HexDump(const unsigned char* data, size_t length, size_t offset, char16_t* out) {
+	size_t rows = 0; //represents the amount of rows formatted by SIMD kernels
+#ifdef CPU_SIMD
+	CpuFeatures::Level level = CpuFeatures::SimdLevel(); //represents the SIMD level of CPU
+	if (level != CpuFeatures::Scalar) { //if true the SIMD kernels format the full rows
+		rows = length / ByteFormat::HexRowBytes;
+		out = (level == CpuFeatures::AVX2) ? ByteFormat::HexRowsAVX2(data, rows, offset, out) : ByteFormat::HexRowsSSSE3(data, rows, offset, out);
+	}
+#endif
+	for (size_t position = rows * ByteFormat::HexRowBytes; position < length; position += ByteFormat::HexRowBytes) { //scalar kernel formats the remaining rows
+		out = ByteFormat::HexRow(data + position, min(ByteFormat::HexRowBytes, length - position), offset + position, out);
+		*out++ = '\n';
+	}
+	return (length > 0) ? out - 1 : out; //last new line isn't part of dump
+}
+
+
+/**
+ * @brief Function for writing the BINARY dump of data, each row starts at offset of its first byte. Buffer must hold BinaryDumpSize(length) characters.
+ * @brief Returns the end of dump, the new line of last row is written after it.
+ * @param unsigned char* data
+ * @param size_t length
+ * @param size_t offset
+ * @param char16_t* out
+ */
+char16_t* ByteFormat::BinaryDump(const unsigned char* data, size_t length, size_t offset, char16_t* out) {
+	size_t rows = 0; //represents the amount of rows formatted by SIMD kernels
+#ifdef CPU_SIMD
+	CpuFeatures::Level level = CpuFeatures::SimdLevel(); //represents the SIMD level of CPU
+	if (level != CpuFeatures::Scalar) { //if true the SIMD kernels format the full rows
+		rows = length / ByteFormat::BinaryRowBytes;
+		out = (level == CpuFeatures::AVX2) ? ByteFormat::BinaryRowsAVX2(data, rows, offset, out) : ByteFormat::BinaryRowsSSSE3(data, rows, offset, out);
+	}
+#endif
+	for (size_t position = rows * ByteFormat::BinaryRowBytes; position < length; position += ByteFormat::BinaryRowBytes) { //scalar kernel formats the remaining rows
+		out = ByteFormat::BinaryRow(data + position, min(ByteFormat::BinaryRowBytes, length - position), offset + position, out);
+		*out++ = '\n';
+	}
+	return (length > 0) ? out - 1 : out; //last new line isn't part of dump
+}
+
+
+#ifdef CPU_SIMD
+/**
+ * @brief Function for widening 16 characters to UTF-16 and storing them with SSE2.
+ * @param char16_t* out
+ * @param __m128i chars
+ */
+static inline void StoreWide(char16_t* out, __m128i chars) {
+	_mm_storeu_si128((__m128i*)out, _mm_unpacklo_epi8(chars, _mm_setzero_si128()));
+	_mm_storeu_si128((__m128i*)(out + 8), _mm_unpackhi_epi8(chars, _mm_setzero_si128()));
+}
+
+
+/**
+ * @brief Function for widening 16 characters to UTF-16 and storing them with one AVX2 store.
+ * @param char16_t* out
+ * @param __m128i chars
+ */
+CPU_TARGET("avx2") static inline void StoreWideAVX2(char16_t* out, __m128i chars) {
+	_mm256_storeu_si256((__m256i*)out, _mm256_cvtepu8_epi16(chars));
+}
+
+
+/**
+ * @brief Function for writing the HEX offset of row and its two spaces with SSSE3, returns the end of offset column.
+ * @brief Writes 16 characters, the two after the column are written over by the row.
+ * @param size_t offset
+ * @param char16_t* out
+ */
+CPU_TARGET("ssse3") static inline char16_t* OffsetSSSE3(size_t offset, char16_t* out) {
+	const __m128i nibbleMask = _mm_set1_epi8(0x0F); //represents the mask of low nibble
+	__m128i value = _mm_cvtsi64_si128((long long)offset); //represents the bytes of offset, lowest byte first
+	__m128i nibbles = _mm_unpacklo_epi8(_mm_and_si128(_mm_srli_epi16(value, 4), nibbleMask), _mm_and_si128(value, nibbleMask)); //represents the high and low nibble of each byte
+	__m128i digits = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)HexDigits), nibbles); //represents the digits of nibbles
+	__m128i chars = _mm_or_si128(_mm_shuffle_epi8(digits, _mm_loadu_si128((const __m128i*)OffsetShuffle.index)), _mm_loadu_si128((const __m128i*)OffsetShuffle.spaces)); //order the digits from highest one and add the spaces
+	StoreWide(out, chars);
+	return out + ByteFormat::OffsetDigits + 2;
+}
+
+
+/**
+ * @brief Function for writing full HEX rows with SSSE3, one row of 16 bytes is one vector. Returns the end of written characters.
+ * @brief Nibbles are turned into digits with a pshufb lookup, the digits are interleaved and spread with spaces into three vectors of the row.
+ * @param unsigned char* data
+ * @param size_t rows
+ * @param size_t offset
+ * @param char16_t* out
+ */
+CPU_TARGET("ssse3") char16_t* ByteFormat::HexRowsSSSE3(const unsigned char* data, size_t rows, size_t offset, char16_t* out) {
+	const __m128i digits = _mm_loadu_si128((const __m128i*)HexDigits); //represents the lookup table of digits
+	const __m128i nibbleMask = _mm_set1_epi8(0x0F); //represents the mask of low nibble
+	const __m128i lastControl = _mm_set1_epi8(0x1F), deleteChar = _mm_set1_epi8(0x7F), dot = _mm_set1_epi8('.'); //represents the bounds of printable bytes and their replacement
+	__m128i first[3], second[3], spaces[3]; //represents the shuffle tables
+	for (int i = 0; i < 3; i++) { //load the shuffle tables once
+		first[i] = _mm_loadu_si128((const __m128i*)HexShuffle.first[i]);
+		second[i] = _mm_loadu_si128((const __m128i*)HexShuffle.second[i]);
+		spaces[i] = _mm_loadu_si128((const __m128i*)HexShuffle.spaces[i]);
+	}
+	for (size_t row = 0; row < rows; row++, data += ByteFormat::HexRowBytes, offset += ByteFormat::HexRowBytes) { //format each row
+		out = OffsetSSSE3(offset, out); //write the offset of row
+		__m128i bytes = _mm_loadu_si128((const __m128i*)data); //load the bytes of row
+		__m128i highDigits = _mm_shuffle_epi8(digits, _mm_and_si128(_mm_srli_epi16(bytes, 4), nibbleMask)); //represents the digits of high nibbles
+		__m128i lowDigits = _mm_shuffle_epi8(digits, _mm_and_si128(bytes, nibbleMask)); //represents the digits of low nibbles
+		__m128i firstDigits = _mm_unpacklo_epi8(highDigits, lowDigits); //represents the two digits of bytes 0 to 7
+		__m128i secondDigits = _mm_unpackhi_epi8(highDigits, lowDigits); //represents the two digits of bytes 8 to 15
+		for (int i = 0; i < 3; i++, out += 16) //spread the digits with spaces, 16 characters in each vector
+			StoreWide(out, _mm_or_si128(_mm_or_si128(_mm_shuffle_epi8(firstDigits, first[i]), _mm_shuffle_epi8(secondDigits, second[i])), spaces[i]));
+		*out++ = ' '; //separate the ASCII column
+		__m128i printable = _mm_and_si128(_mm_cmpgt_epi8(bytes, lastControl), _mm_cmplt_epi8(bytes, deleteChar)); //signed compare, bytes above 0x7F are negative so they're not printable
+		StoreWide(out, _mm_or_si128(_mm_and_si128(printable, bytes), _mm_andnot_si128(printable, dot))); //write the ASCII column
+		out += ByteFormat::HexRowBytes;
+		*out++ = '\n';
+	}
+	return out;
+}
+
+
+/**
+ * @brief Function for writing full HEX rows with AVX2, two rows are formatted at once, one in each lane. Returns the end of written characters.
+ * @param unsigned char* data
+ * @param size_t rows
+ * @param size_t offset
+ * @param char16_t* out
+ */
+CPU_TARGET("avx2") char16_t* ByteFormat::HexRowsAVX2(const unsigned char* data, size_t rows, size_t offset, char16_t* out) {
+	const __m256i digits = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)HexDigits)); //represents the lookup table of digits in each lane
+	const __m256i nibbleMask = _mm256_set1_epi8(0x0F); //represents the mask of low nibble
+	const __m256i lastControl = _mm256_set1_epi8(0x1F), deleteChar = _mm256_set1_epi8(0x7F), dot = _mm256_set1_epi8('.'); //represents the bounds of printable bytes and their replacement
+	__m256i first[3], second[3], spaces[3]; //represents the shuffle tables in each lane
+	for (int i = 0; i < 3; i++) { //load the shuffle tables once
+		first[i] = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)HexShuffle.first[i]));
+		second[i] = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)HexShuffle.second[i]));
+		spaces[i] = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)HexShuffle.spaces[i]));
+	}
+	size_t row = 0; //represents the current row
+	for (; row + 2 <= rows; row += 2, data += 2 * ByteFormat::HexRowBytes, offset += 2 * ByteFormat::HexRowBytes) { //format each pair of rows
+		__m256i bytes = _mm256_loadu_si256((const __m256i*)data); //load the bytes of both rows, lanes keep the rows apart since pshufb and unpack work in each lane
+		__m256i highDigits = _mm256_shuffle_epi8(digits, _mm256_and_si256(_mm256_srli_epi16(bytes, 4), nibbleMask)); //represents the digits of high nibbles
+		__m256i lowDigits = _mm256_shuffle_epi8(digits, _mm256_and_si256(bytes, nibbleMask)); //represents the digits of low nibbles
+		__m256i firstDigits = _mm256_unpacklo_epi8(highDigits, lowDigits); //represents the two digits of bytes 0 to 7 of each row
+		__m256i secondDigits = _mm256_unpackhi_epi8(highDigits, lowDigits); //represents the two digits of bytes 8 to 15 of each row
+		__m256i chars[3]; //represents the characters of digits and spaces of both rows
+		for (int i = 0; i < 3; i++)
+			chars[i] = _mm256_or_si256(_mm256_or_si256(_mm256_shuffle_epi8(firstDigits, first[i]), _mm256_shuffle_epi8(secondDigits, second[i])), spaces[i]);
+		__m256i printable = _mm256_and_si256(_mm256_cmpgt_epi8(bytes, lastControl), _mm256_cmpgt_epi8(deleteChar, bytes)); //signed compare, bytes above 0x7F are negative so they're not printable
+		__m256i ascii = _mm256_or_si256(_mm256_and_si256(printable, bytes), _mm256_andnot_si256(printable, dot)); //represents the ASCII columns of both rows
+
+		out = OffsetSSSE3(offset, out); //write the first row from lower lanes
+		for (int i = 0; i < 3; i++, out += 16)
+			StoreWideAVX2(out, _mm256_castsi256_si128(chars[i]));
+		*out++ = ' ';
+		StoreWideAVX2(out, _mm256_castsi256_si128(ascii));
+		out += ByteFormat::HexRowBytes;
+		*out++ = '\n';
+
+		out = OffsetSSSE3(offset + ByteFormat::HexRowBytes, out); //write the second row from upper lanes
+		for (int i = 0; i < 3; i++, out += 16)
+			StoreWideAVX2(out, _mm256_extracti128_si256(chars[i], 1));
+		*out++ = ' ';
+		StoreWideAVX2(out, _mm256_extracti128_si256(ascii, 1));
+		out += ByteFormat::HexRowBytes;
+		*out++ = '\n';
+	}
+	if (row < rows) //if true one row is left, SSSE3 kernel formats it
+		out = ByteFormat::HexRowsSSSE3(data, rows - row, offset, out);
+	return out;
+}
+
+
+/**
+ * @brief Function for writing full BINARY rows with SSSE3, one row of 8 bytes is expanded to its 72 characters in five vectors. Returns the end of written characters.
+ * @brief Each character gets its byte with pshufb, the byte is masked with the bit of character and compared with it to pick '0' or '1'.
+ * @param unsigned char* data
+ * @param size_t rows
+ * @param size_t offset
+ * @param char16_t* out
+ */
+CPU_TARGET("ssse3") char16_t* ByteFormat::BinaryRowsSSSE3(const unsigned char* data, size_t rows, size_t offset, char16_t* out) {
+	__m128i index[5], bits[5], ones[5], base[5]; //represents the expansion tables
+	for (int i = 0; i < 5; i++) { //load the expansion tables once
+		index[i] = _mm_loadu_si128((const __m128i*)BinaryExpand.index[i]);
+		bits[i] = _mm_loadu_si128((const __m128i*)BinaryExpand.bits[i]);
+		ones[i] = _mm_loadu_si128((const __m128i*)BinaryExpand.ones[i]);
+		base[i] = _mm_loadu_si128((const __m128i*)BinaryExpand.base[i]);
+	}
+	for (size_t row = 0; row < rows; row++, data += ByteFormat::BinaryRowBytes, offset += ByteFormat::BinaryRowBytes) { //format each row
+		out = OffsetSSSE3(offset, out); //write the offset of row
+		__m128i bytes = _mm_loadl_epi64((const __m128i*)data); //load the 8 bytes of row
+		for (int i = 0; i < 5; i++) { //expand the bits, last vector holds only 8 characters of row
+			__m128i selected = _mm_shuffle_epi8(bytes, index[i]); //represents the byte of each character
+			__m128i isSet = _mm_cmpeq_epi8(_mm_and_si128(selected, bits[i]), bits[i]); //represents the characters of set bits
+			__m128i chars = _mm_or_si128(base[i], _mm_and_si128(isSet, ones[i])); //'0' becomes '1' for set bits, spaces stay
+			_mm_storeu_si128((__m128i*)out, _mm_unpacklo_epi8(chars, _mm_setzero_si128()));
+			if (i < 4) //if true the vector is full
+				_mm_storeu_si128((__m128i*)(out + 8), _mm_unpackhi_epi8(chars, _mm_setzero_si128()));
+			out += (i < 4) ? 16 : 8;
+		}
+		*out++ = '\n';
+	}
+	return out;
+}
+
+
+/**
+ * @brief Function for writing full BINARY rows with AVX2, two rows are expanded at once, one in each lane. Returns the end of written characters.
+ * @param unsigned char* data
+ * @param size_t rows
+ * @param size_t offset
+ * @param char16_t* out
+ */
+CPU_TARGET("avx2") char16_t* ByteFormat::BinaryRowsAVX2(const unsigned char* data, size_t rows, size_t offset, char16_t* out) {
+	__m256i index[5], bits[5], ones[5], base[5]; //represents the expansion tables, upper lanes index the second row
+	for (int i = 0; i < 5; i++) { //load the expansion tables once
+		index[i] = _mm256_loadu_si256((const __m256i*)BinaryExpand.index[i]);
+		bits[i] = _mm256_loadu_si256((const __m256i*)BinaryExpand.bits[i]);
+		ones[i] = _mm256_loadu_si256((const __m256i*)BinaryExpand.ones[i]);
+		base[i] = _mm256_loadu_si256((const __m256i*)BinaryExpand.base[i]);
+	}
+	size_t row = 0; //represents the current row
+	for (; row + 2 <= rows; row += 2, data += 2 * ByteFormat::BinaryRowBytes, offset += 2 * ByteFormat::BinaryRowBytes) { //format each pair of rows
+		__m256i bytes = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)data)); //load the 16 bytes of both rows into each lane
+		__m256i chars[5]; //represents the characters of both rows
+		for (int i = 0; i < 5; i++) {
+			__m256i selected = _mm256_shuffle_epi8(bytes, index[i]); //represents the byte of each character
+			__m256i isSet = _mm256_cmpeq_epi8(_mm256_and_si256(selected, bits[i]), bits[i]); //represents the characters of set bits
+			chars[i] = _mm256_or_si256(base[i], _mm256_and_si256(isSet, ones[i])); //'0' becomes '1' for set bits, spaces stay
+		}
+
+		out = OffsetSSSE3(offset, out); //write the first row from lower lanes
+		for (int i = 0; i < 4; i++, out += 16)
+			StoreWideAVX2(out, _mm256_castsi256_si128(chars[i]));
+		_mm_storeu_si128((__m128i*)out, _mm_cvtepu8_epi16(_mm256_castsi256_si128(chars[4]))); //last 8 characters of row
+		out += 8;
+		*out++ = '\n';
+
+		out = OffsetSSSE3(offset + ByteFormat::BinaryRowBytes, out); //write the second row from upper lanes
+		for (int i = 0; i < 4; i++, out += 16)
+			StoreWideAVX2(out, _mm256_extracti128_si256(chars[i], 1));
+		_mm_storeu_si128((__m128i*)out, _mm_cvtepu8_epi16(_mm256_extracti128_si256(chars[4], 1))); //last 8 characters of row
+		out += 8;
+		*out++ = '\n';
+	}
+	if (row < rows) //if true one row is left, SSSE3 kernel formats it
+		out = ByteFormat::BinaryRowsSSSE3(data, rows - row, offset, out);
+	return out;
+}
+#endif
\ No newline at end of file
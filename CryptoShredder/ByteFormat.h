@@ -0,0 +1,38 @@
+#ifndef _ByteFormat_H
+#define _ByteFormat_H
+#define _CRT_SECURE_NO_WARNINGS
+#include <iostream>
+#include <string.h>
+#include <cstdint>
+#include "CpuFeatures.h"
+
+using namespace std;
+
+/**
+ * @brief Class for formatting bytes as HEX and BINARY dumps, rows are written straight into a UTF-16 buffer that the GUI shows without copying.
+ * @brief Each row starts with the HEX offset of its first byte, HEX rows end with the printable ASCII characters of their bytes.
+ * @brief Full rows are formatted with SSSE3 nibble and bit lookups through pshufb, AVX2 formats two rows at once, the kernel is chosen
+ * @brief by the SIMD level of CPU and a scalar kernel formats the last partial row and runs on CPUs without SSSE3.
+ */
+class ByteFormat {
+private:
+	static char16_t* HexRow(const unsigned char* data, size_t length, size_t offset, char16_t* out);
+	static char16_t* BinaryRow(const unsigned char* data, size_t length, size_t offset, char16_t* out);
+	static char16_t* HexRowsSSSE3(const unsigned char* data, size_t rows, size_t offset, char16_t* out);
+	static char16_t* HexRowsAVX2(const unsigned char* data, size_t rows, size_t offset, char16_t* out);
+	static char16_t* BinaryRowsSSSE3(const unsigned char* data, size_t rows, size_t offset, char16_t* out);
+	static char16_t* BinaryRowsAVX2(const unsigned char* data, size_t rows, size_t offset, char16_t* out);
+
+public:
+	static constexpr size_t HexRowBytes = 16; //amount of bytes in each HEX row
+	static constexpr size_t BinaryRowBytes = 8; //amount of bytes in each BINARY row
+	static constexpr size_t OffsetDigits = 12; //amount of HEX digits of offset column, enough for files of 256 TB
+	static constexpr size_t HexRowChars = OffsetDigits + 2 + 3 * HexRowBytes + 1 + HexRowBytes + 1; //characters of full HEX row with its new line
+	static constexpr size_t BinaryRowChars = OffsetDigits + 2 + 9 * BinaryRowBytes + 1; //characters of full BINARY row with its new line
+	static char16_t* Offset(size_t offset, char16_t* out);
+	static size_t HexDumpSize(size_t length);
+	static size_t BinaryDumpSize(size_t length);
+	static char16_t* HexDump(const unsigned char* data, size_t length, size_t offset, char16_t* out);
+	static char16_t* BinaryDump(const unsigned char* data, size_t length, size_t offset, char16_t* out);
+};
+#endif
\ No newline at end of file
@@ -0,0 +1,36 @@
+#include "CpuFeatures.h"
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+
+/**
+ * @brief Function for getting the SIMD level of CPU, detected once on first call.
+ */
+CpuFeatures::Level CpuFeatures::SimdLevel() {
+	static const Level level = [] { //represents the detected level
+#ifdef CPU_SIMD
+#ifdef _MSC_VER
+		int info[4] = {}; //represents the registers of cpuid
+		__cpuid(info, 0);
+		int maxLeaf = info[0]; //represents the highest leaf of cpuid
+		__cpuid(info, 1);
+		bool hasSSSE3 = (info[2] & (1 << 9)) != 0; //flag for SSSE3
+		bool hasOSAVX = (info[2] & (1 << 27)) != 0 && (info[2] & (1 << 28)) != 0 && (_xgetbv(0) & 0x6) == 0x6; //flag for AVX with its registers saved by system
+		bool hasAVX2 = false; //flag for AVX2
+		if (hasOSAVX && maxLeaf >= 7) { //if true we can check the extended features
+			__cpuidex(info, 7, 0);
+			hasAVX2 = (info[1] & (1 << 5)) != 0;
+		}
+#else
+		__builtin_cpu_init(); //initialize the CPU features of compiler runtime
+		bool hasSSSE3 = __builtin_cpu_supports("ssse3"); //flag for SSSE3
+		bool hasAVX2 = __builtin_cpu_supports("avx2"); //flag for AVX2, also checks that system saves the AVX registers
+#endif
+		return hasAVX2 ? CpuFeatures::AVX2 : hasSSSE3 ? CpuFeatures::SSSE3 : CpuFeatures::Scalar;
+#else
+		return CpuFeatures::Scalar; //other CPUs use the scalar kernels
+#endif
+	}();
+	return level;
+}
\ No newline at end of file
@@ -0,0 +1,35 @@
+#ifndef _CpuFeatures_H
+#define _CpuFeatures_H
+#define _CRT_SECURE_NO_WARNINGS
+#include <iostream>
+#include <string.h>
+#if defined(_M_X64) || defined(__x86_64__)
+#define CPU_SIMD //x86-64 CPUs may have SSSE3 and AVX2, kernels are compiled for them and chosen at runtime
+#include <immintrin.h>
+#ifdef _MSC_VER
+#define CPU_TARGET(isa) //MSVC compiles intrinsics of any instruction set without flags
+#else
+#define CPU_TARGET(isa) __attribute__((target(isa))) //GCC and Clang compile intrinsics only in functions that target their instruction set
+#endif
+#endif
+
+using namespace std;
+
+/**
+ * @brief Class for detecting the SIMD instruction sets of CPU, kernels of viewer are compiled for each set and the best one is chosen at runtime
+ * @brief since the baseline of x86-64 is SSE2.
+ */
+class CpuFeatures {
+public:
+	/**
+	 * @brief Enum that represents the SIMD level of CPU, each level includes the ones below it.
+	 */
+	enum Level {
+		Scalar = 0, //no SIMD kernels, other CPUs than x86-64
+		SSSE3 = 1, //SSE2 and SSSE3 with pshufb
+		AVX2 = 2 //AVX2 with registers saved by system
+	};
+
+	static Level SimdLevel();
+};
+#endif
\ No newline at end of file
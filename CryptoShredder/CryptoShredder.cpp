@@ -16,31 +16,40 @@ CryptoShredder::CryptoShredder(QWidget* parent) : QMainWindow(parent) {
     //setup GUI elements at start of program//
     ui.cipherFrame->setVisible(false); //hide cipherFrame and contents
     ui.wipeFrame->setVisible(true); //show wipeFrame and contents
-    this->listViewModel = new QStringListModel(this); //initialize the model for listView in GUI
+    this->listViewModel = new FileListModel(this); //initialize the model for listView in GUI
     this->signal = new SignalProxy(); //initialize the signal proxy for the foreigner classes
     this->infoImageLabel = new ImageLabel("images/infoIcon.png", QPoint(1020, 10), QSize(40, 40), this); //set the info icon in GUI
     this->infoImageLabel->setToolTip("<html><head/><body><p><span style='font-size:10pt;'>General information<br>about CryptoShredder.</span></p></body></html>"); //set toolTip for info icon
     this->optionsImageLabel = new ImageLabel("images/cipherIcon.png", QPoint(955, 10), QSize(40, 40), this); //set the options icon in GUI
     this->optionsImageLabel->setToolTip("<html><head/><body><p><span style='font-size:10pt;'>Encrypt/Decrypt files.</span></p></body></html>"); //set toolTip for options icon
+    this->settingsImageLabel = new ImageLabel("images/settingsIcon.png", QPoint(890, 10), QSize(40, 40), this); //set the settings icon in GUI
+    this->settingsImageLabel->setToolTip("<html><head/><body><p><span style='font-size:10pt;'>Settings and benchmark.</span></p></body></html>"); //set toolTip for settings icon
     this->keyValidator = new QRegExpValidator(QRegExp("[a-zA-Z0-9\\W]{16}|[a-zA-Z0-9\\W]{24}|[a-zA-Z0-9\\W]{32}"), this); //regular expression for key 
     ui.KeyLineEdit->setValidator(this->keyValidator); //set the key validator
     ui.FileListView->setModel(listViewModel); //set the list model for listView in GUI to add elements
     ui.FileListView->setEditTriggers(QAbstractItemView::NoEditTriggers); //set the listView to be uneditable
+    ui.FileListView->setContextMenuPolicy(Qt::CustomContextMenu); //right click on a file shows its menu
     ui.PassesSpinBox->findChild<QLineEdit*>()->setReadOnly(true); //remove the lineEdit in spinBox
+    this->progressTimer = new QTimer(this); //initialize the timer that samples the progress of job
+    this->progressTimer->setInterval(ProgressInterval); //sample the progress at a fixed rate
 
     //slots for ui elements//
     connect(ui.ProcessButton, &QPushButton::clicked, this, &CryptoShredder::processFiles);
     connect(ui.CancelButton, &QPushButton::clicked, this, &CryptoShredder::cancelProcess);
     connect(ui.ChooseFilesButton, &QPushButton::clicked, this, &CryptoShredder::openFileDialog);
+    connect(ui.ChooseFolderButton, &QPushButton::clicked, this, &CryptoShredder::openFolderDialog);
     connect(ui.ClearScreenButton, &QPushButton::clicked, this, &CryptoShredder::clearContents);
     connect(ui.FileListView, &QAbstractItemView::doubleClicked, this, &CryptoShredder::doubleClickedFile);
+    connect(ui.FileListView, &QWidget::customContextMenuRequested, this, &CryptoShredder::showFileMenu);
     connect(ui.CipherCheckBox, &QCheckBox::stateChanged, this, &CryptoShredder::cipherCheckBoxClicked);
     connect(ui.KeyLineEdit, &QLineEdit::textChanged, this, &CryptoShredder::checkLineEditValidator);
-    connect(this->signal, &SignalProxy::signalUpdateListView, this, &CryptoShredder::updateListView);
     connect(this->signal, &SignalProxy::signalMessageBox, this, &CryptoShredder::showMessageBox);
-    connect(this->signal, &SignalProxy::signalSetListViewTags, this, &CryptoShredder::setListViewTags);
+    connect(this->signal, &SignalProxy::signalJobFinished, this, &CryptoShredder::jobFinished);
+    connect(this->signal, &SignalProxy::signalMetadataLoaded, this, &CryptoShredder::metadataLoaded);
+    connect(this->progressTimer, &QTimer::timeout, this, &CryptoShredder::updateProgress);
     connect(this->infoImageLabel, &ImageLabel::clicked, this, &CryptoShredder::infoLabelClicked);
     connect(this->optionsImageLabel, &ImageLabel::clicked, this, &CryptoShredder::optionsLabelClicked);
+    connect(this->settingsImageLabel, &ImageLabel::clicked, this, &CryptoShredder::settingsLabelClicked);
 }
 
 
@@ -48,6 +57,8 @@ CryptoShredder::CryptoShredder(QWidget* parent) : QMainWindow(parent) {
  * @brief Destructor of GUI.
  */
 CryptoShredder::~CryptoShredder() {
+    if (this->metadataThread.joinable()) //if true metadata of chosen files is still loading
+        this->metadataThread.join(); //wait for the load before we delete the signal object it uses
     if (this->fileHandler) //if there's an object of fileHandler initialized
         delete this->fileHandler; //delete the fileHandler object
     delete this->listViewModel; //delete the list view model
@@ -55,6 +66,8 @@ CryptoShredder::~CryptoShredder() {
     delete this->signal; //delete the signal object
     delete this->infoImageLabel; //delete the infoImageLabel object
     delete this->optionsImageLabel; //delete the optionsImageLabel object
+    delete this->settingsImageLabel; //delete the settingsImageLabel object
+    delete this->progressTimer; //delete the progress timer
 }
 
 
@@ -79,123 +92,130 @@ void CryptoShredder::closeEvent(QCloseEvent* event) {
 
 
 /**
- * @brief Method for adding elements to the FileListView in GUI.
- * @param QString item
+ * @brief Method that is called when all tasks of job finished so we can delete unnecessary memory.
  */
-void CryptoShredder::addItemToListView(const QString& item) {
-    QStringList itemList = this->listViewModel->stringList(); //get current item list in the listView
-    itemList.append(item); //add the item to item list 
-    this->listViewModel->setStringList(itemList); //add item list to the GUI FileListView
-}
-
-
-/**
- * @brief Method to update the listView when thread finishes its work.
- * @param "QString item
- */
-void CryptoShredder::updateListView(const QString& fileDictionaryName, const QString& fileName, const QString& tag) {
-    this->GUIMutex.lock(); //lock the GUI mutex to prevent race conditions with threads
-    if (this->fileHandler) { //update only if fileHandler object is initialized
-        int fileIndex = this->fileDictionary[fileDictionaryName.toStdString()]; //get the index of the file we need to update in fileDictionary
-        QModelIndex index = this->listViewModel->index(fileIndex, 0); //convert the integer index to QModelIndex for Qt list model
-        this->listViewModel->setData(index, fileName + tag, Qt::EditRole); //set the tag in the specific file to indicate that its finished
-        this->checkThreads(); //call checkThreads method to determine if we can delete allocated memory
-    }
-    this->GUIMutex.unlock(); //unlock mutex
-}
-
-
-/**
- * @brief Method to check if threads finished their work so we can delete unnecessary memory.
- */
-void CryptoShredder::checkThreads() {
+void CryptoShredder::jobFinished() {
     this->GUIMutex.lock();  //lock the GUI mutex to prevent race conditions with threads
     if (this->fileHandler) { //check only if fileHandler object is initialized
-        this->fileHandler->setNumOfThreads(this->fileHandler->getNumOfThreads() - 1); //we decrease the amount of runnning threads with getter and setter methods
-        int incrementAmount = 100 / this->filePathList.size(); //increment the progress bar with an amount that represents the division of num of files
-        ui.progressBar->setValue(ui.progressBar->value() + incrementAmount); //increment progress bar
-        if (this->fileHandler->getNumOfThreads() == 0) { //means that all threads finished their work 
-            this->fileHandler->setThreadsRunning(false); //set threadsRunning flag to false indicating all threads finished work
-            ui.progressBar->setValue(100); //we set the progress bar to 100 when we finish the operation
-        }
-        if (!(this->fileHandler->areThreadsRunning())) { //if true the operation finished so we clear the necessary elements
-            this->filePathList.clear(); //clear filePathList
-            this->fileDictionary.clear(); //clear file dictionary
-            this->fileCounter = 0; //set the fileCounter back to zero
-            delete this->fileHandler; //delete fileHandler object
-            this->fileHandler = NULL; //set pointer of fileHandler to NULL for next operation
-            if (File::getIsCanceled()) { //if user canceled the operation
-                if (this->isClosing) { // if user wants to close program
-                    this->isClosing = false; //set isClosing flag to false
-                    this->close(); //call close method to close program
-                }
-                else { //else user didn't want to close program, we show messagebox and continue
-                    File::setIsCanceled(false); //set the isCanceled flag back to false
-                    if (this->wipe) //if we're wiping
-                        this->showMessageBox("Wipe Canceled", "Secure wiping for selected files has been canceled, files that were in process were canceled.", "information"); //show messagebox
-                    else { //else we encrypt/decrypt
-                        if (!ui.CipherCheckBox->isChecked()) //if true we show messagebox for encryption
-                            this->showMessageBox("Encryption Canceled", "Secure encryption for selected files has been canceled, files that were in process were canceled.", "information"); //show messagebox
-                        else //else we show messagebox for decryption
-                            this->showMessageBox("Decryption Canceled", "Secure decryption for selected files has been canceled, files that were in process were canceled.", "information"); //show messagebox
-                    }
-                }
+        this->fileHandler->getJobFuture().wait(); //job future is ready once every task returned, so no worker uses the files anymore
+        this->progressTimer->stop(); //stop sampling the progress of job
+        while (this->applyFileEvents() > 0); //handle the file events that are left before we delete the files
+        ui.progressBar->setFormat("%p%"); //remove the rates and ETA from progress bar
+        ui.progressBar->setValue(100); //we set the progress bar to 100 when we finish the operation
+        bool isCanceled = this->fileHandler->getJob().getIsCanceled(); //represents if user canceled the job
+        bool isFailed = this->fileHandler->getJob().getIsFailed(); //represents if one of files of job failed
+        this->filePathList.clear(); //clear filePathList
+        this->fileMetadataList.clear(); //clear fileMetadataList
+        this->folderPathList.clear(); //clear folderPathList
+        this->listViewModel->finishJob(); //items of this job keep their status until new items are chosen
+        delete this->fileHandler; //delete fileHandler object
+        this->fileHandler = NULL; //set pointer of fileHandler to NULL for next operation
+        if (isCanceled) { //if user canceled the operation
+            if (this->isClosing) { // if user wants to close program
+                this->isClosing = false; //set isClosing flag to false
+                this->close(); //call close method to close program
             }
-            else if (File::getIsFailed()) { //else if one of threads failed operation
-                File::setIsFailed(false); //set the isFailed flag back to false
+            else { //else user didn't want to close program, we show messagebox and continue
                 if (this->wipe) //if we're wiping
-                    this->showMessageBox("Wipe Failed", "Secure wiping has failed for one or more selected files.", "critical"); //show messagebox
+                    this->showMessageBox("Wipe Canceled", "Secure wiping for selected files has been canceled, files that were in process were canceled.", "information"); //show messagebox
                 else { //else we encrypt/decrypt
                     if (!ui.CipherCheckBox->isChecked()) //if true we show messagebox for encryption
-                        this->showMessageBox("Encryption Failed", "Secure encryption has failed for one or more selected files.", "critical"); //show messagebox
+                        this->showMessageBox("Encryption Canceled", "Secure encryption for selected files has been canceled, files that were in process were canceled.", "information"); //show messagebox
                     else //else we show messagebox for decryption
-                        this->showMessageBox("Decryption Failed", "Secure decryption has failed for one or more selected files.", "critical"); //show messagebox
+                        this->showMessageBox("Decryption Canceled", "Secure decryption for selected files has been canceled, files that were in process were canceled.", "information"); //show messagebox
                 }
             }
-            else { //else we finished the operation successfully
-                if (this->wipe) //if we're wiping
-                    this->showMessageBox("Wipe Finished", "Secure wiping for selected files completed successfully.", "information"); //show messagebox with success message
-                else { //else we encrypt/decrypt
-                    if (!ui.CipherCheckBox->isChecked()) //if true we show messagebox for encryption
-                        this->showMessageBox("Encryption Finished", "Secure encryption for selected files completed successfully.", "information"); //show messagebox
-                    else //else we show messagebox for decryption
-                        this->showMessageBox("Decryption Finished", "Secure decryption for selected files completed successfully.", "information"); //show messagebox
-                }
+        }
+        else if (isFailed) { //else if one of threads failed operation
+            if (this->wipe) //if we're wiping
+                this->showMessageBox("Wipe Failed", "Secure wiping has failed for one or more selected files.", "critical"); //show messagebox
+            else { //else we encrypt/decrypt
+                if (!ui.CipherCheckBox->isChecked()) //if true we show messagebox for encryption
+                    this->showMessageBox("Encryption Failed", "Secure encryption has failed for one or more selected files.", "critical"); //show messagebox
+                else //else we show messagebox for decryption
+                    this->showMessageBox("Decryption Failed", "Secure decryption has failed for one or more selected files.", "critical"); //show messagebox
+            }
+        }
+        else { //else we finished the operation successfully
+            if (this->wipe) //if we're wiping
+                this->showMessageBox("Wipe Finished", "Secure wiping for selected files completed successfully.", "information"); //show messagebox with success message
+            else { //else we encrypt/decrypt
+                if (!ui.CipherCheckBox->isChecked()) //if true we show messagebox for encryption
+                    this->showMessageBox("Encryption Finished", "Secure encryption for selected files completed successfully.", "information"); //show messagebox
+                else //else we show messagebox for decryption
+                    this->showMessageBox("Decryption Finished", "Secure decryption for selected files completed successfully.", "information"); //show messagebox
             }
-            ui.RemoveFilesCheckBox->setEnabled(true); //set the remove checkBox to be unclickable
-            ui.CipherCheckBox->setEnabled(true); //set the cipher checkBox to be clickable
-            ui.PassesSpinBox->setEnabled(true); //set the passes spin box to be clickable
-            ui.KeyLineEdit->setEnabled(true); //set the key line edit to be clickable
-            ui.progressBar->setTextVisible(false); //set the progressBar text to false not showing the text
-            ui.progressBar->setValue(0); //set the progress bar back to zero
         }
+        ui.RemoveFilesCheckBox->setEnabled(true); //set the remove checkBox to be unclickable
+        ui.CipherCheckBox->setEnabled(true); //set the cipher checkBox to be clickable
+        ui.PassesSpinBox->setEnabled(true); //set the passes spin box to be clickable
+        ui.KeyLineEdit->setEnabled(true); //set the key line edit to be clickable
+        ui.progressBar->setTextVisible(false); //set the progressBar text to false not showing the text
+        ui.progressBar->setValue(0); //set the progress bar back to zero
     }
     this->GUIMutex.unlock(); //unlock mutex
 }
 
 
 /**
- * @brief Method to set tags for files in the listView in GUI.
- * @param QString tag
- * @param QString currentTag
+ * @brief Method for starting to sample the progress of job that was just started.
  */
-void CryptoShredder::setListViewTags(const QString& tag, const QString& currentTag) {
-    QStringList items = this->listViewModel->stringList(); //get item list from the listView model
-    if (!items.isEmpty()) { //check if the listView is not empty
-        if (currentTag == NULL) { //if NULL we need to add the tags to items that in the fileDictionary
-            for (const auto& [fileName, index] : this->fileDictionary) { //iterate over fileDictionary items
-                items[index] += tag; //add the tag to the items
-            }
-        }
-        else { //if not NULL we need to add the tag to all items
-            for (int i = 0; i < items.size(); i++) { //iterate over listView items
-                int lastPosition = items[i].lastIndexOf(currentTag); //get the last index position of the file name without current tag
-                if (lastPosition != -1) //if true we found the position we need to add new tag from
-                    items[i] = items[i].left(lastPosition) + tag; //add the new tag to the file name
-            }
-        }
-        this->listViewModel->setStringList(items); //set the list with updated tags
+void CryptoShredder::startProgress() {
+    this->lastProgressBytes = 0; //job starts with no bytes done
+    this->throughput = 0; //reset the throughput
+    this->filesDone = 0; //job starts with no files done
+    this->lastProgressFiles = 0;
+    this->fileRate = 0; //reset the file rate
+    this->progressClock.start(); //start measuring time from now
+    this->lastProgressTime = 0; //first sample is measured from start of job
+    ui.progressBar->setValue(0); //set the progress bar to zero
+    this->progressTimer->start(); //start sampling the progress
+}
+
+
+/**
+ * @brief Method for draining the file events of job into one batch of updates and applying it to listView, returns the amount of events handled.
+ */
+size_t CryptoShredder::applyFileEvents() {
+    this->fileUpdates.clear(); //reuse the buffer of last drain
+    size_t handled = this->fileHandler->processEvents(this->fileUpdates); //collect the changes of files that finished since last drain
+    this->listViewModel->applyUpdates(this->fileUpdates); //apply the whole drain as one model update
+    return handled;
+}
+
+
+/**
+ * @brief Method that drains the file events of job and samples its counters to show the progress, throughput, files per second and ETA in progress bar.
+ * @brief Called by progress timer about 30 times a second, workers only push events and add to atomic counters so the GUI never waits on them
+ * @brief and a burst of finished files is coalesced into one listView update per tick.
+ */
+void CryptoShredder::updateProgress() {
+    if (!this->fileHandler) //if true there's no job to sample
+        return;
+    this->filesDone += this->applyFileEvents(); //update the listView with the files that finished since last sample
+    size_t bytesDone = this->fileHandler->getJob().getBytesDone(); //represents the bytes done by job
+    size_t totalBytes = this->fileHandler->getJob().getTotalBytes(); //represents the bytes of whole job
+    qint64 now = this->progressClock.elapsed(); //represents the time of current sample
+    if (now > this->lastProgressTime) { //if true we can measure the rates since last sample
+        double elapsed = (double)(now - this->lastProgressTime) / 1000.0; //represents the seconds since last sample
+        double currentThroughput = (double)(bytesDone - this->lastProgressBytes) / elapsed; //represents the throughput since last sample
+        double currentFileRate = (double)(this->filesDone - this->lastProgressFiles) / elapsed; //represents the files per second since last sample
+        this->throughput = (this->throughput == 0) ? currentThroughput : (1.0 - SmoothingFactor) * this->throughput + SmoothingFactor * currentThroughput; //smooth the throughput so ETA doesn't jump
+        this->fileRate = (this->fileRate == 0) ? currentFileRate : (1.0 - SmoothingFactor) * this->fileRate + SmoothingFactor * currentFileRate; //smooth the file rate
+        this->lastProgressTime = now; //save the time of sample
+        this->lastProgressBytes = bytesDone; //save the bytes of sample
+        this->lastProgressFiles = this->filesDone; //save the files of sample
     }
+    if (totalBytes == 0) //if true the job wasn't planned yet or has nothing to write
+        return;
+    ui.progressBar->setValue((int)min((double)bytesDone * 100.0 / (double)totalBytes, 100.0)); //set the progress of job
+    QString eta = "--:--"; //represents the estimated time left
+    if (this->throughput > 0 && bytesDone < totalBytes) { //if true we can estimate the time left
+        qint64 secondsLeft = (qint64)((double)(totalBytes - bytesDone) / this->throughput); //represents the seconds left
+        eta = (secondsLeft >= 3600) ? QString("%1:%2:%3").arg(secondsLeft / 3600).arg((secondsLeft / 60) % 60, 2, 10, QChar('0')).arg(secondsLeft % 60, 2, 10, QChar('0'))
+            : QString("%1:%2").arg(secondsLeft / 60, 2, 10, QChar('0')).arg(secondsLeft % 60, 2, 10, QChar('0'));
+    }
+    ui.progressBar->setFormat(QString("%p% - %1 MB/s - %2 files/s - ETA %3").arg(this->throughput / (1024.0 * 1024.0), 0, 'f', 1).arg(this->fileRate, 0, 'f', 0).arg(eta)); //show the throughput, file rate and ETA in progress bar
 }
 
 
@@ -223,7 +243,9 @@ QMessageBox::StandardButton CryptoShredder::showMessageBox(const QString& title,
  * @brief Method for processing files for wiping or encryption/decryption.
  */
 void CryptoShredder::processFiles() {
-    if (this->fileHandler == NULL && !(this->fileDictionary.empty())) { //if true we can start the wipe
+    if (this->isLoadingFiles()) //if true chosen files are still loading, job starts with all of them
+        return; //finish the method's work
+    if (this->fileHandler == NULL && this->listViewModel->hasQueuedItems()) { //if true we can start the wipe
         QMessageBox::StandardButton choice;
         if (this->wipe) { //if wipe flag is set we're wiping the files
             choice = showMessageBox("Starting File Wiping", "Please be aware that all data in the selected files will be permanently erased and cannot be recovered. Are you sure you want to proceed?", "question");
@@ -231,14 +253,16 @@ void CryptoShredder::processFiles() {
                 return; //finish the method's work
 
             //initialize fileHandler and start wiping process
-            this->fileHandler = new FileHandler(this->filePathList, this->signal); //initialize the fileHandler with the required parameters
+            this->fileHandler = new FileHandler(this->filePathList, this->fileMetadataList, this->signal, this->folderPathList); //initialize the fileHandler with the required parameters
             if (this->fileHandler) { //check if we successfully initialized the fileHandler
+                this->fileHandler->applySettings(this->jobSettings); //apply the background mode, bandwidth limit and threads from settings window
                 int numOfPasses = ui.PassesSpinBox->value(); //get number of passes from GUI
                 bool toRemove = ui.RemoveFilesCheckBox->isChecked(); //check if user wants to delete files after wipe
                 ui.progressBar->setTextVisible(true); //set the progressBar text to be visible
                 ui.RemoveFilesCheckBox->setEnabled(false); //set the remove checkBox to be unclickable
                 ui.PassesSpinBox->setEnabled(false); //set the passes spin box to be unclickable
-                this->setListViewTags(" - Processing.."); //set tags to the items in listView indicating that wiping started
+                this->listViewModel->startJob(ItemOperation::Wipe); //set the status of items in listView indicating that wiping started
+                this->startProgress(); //start sampling the progress of job
                 this->fileHandler->initWipe(numOfPasses, toRemove); //call our initWipe method to initiate wipe on specified files
             }
             else //if we failed to initialize fileHandler we show error message
@@ -264,20 +288,22 @@ void CryptoShredder::processFiles() {
                 return; //finish the method's work
 
             //initialize fileHandler and start encryption/decryption process
-            this->fileHandler = new FileHandler(this->filePathList, this->signal); //initialize the fileHandler with the required parameters
+            this->fileHandler = new FileHandler(this->filePathList, this->fileMetadataList, this->signal, this->folderPathList); //initialize the fileHandler with the required parameters
             if (this->fileHandler) { //check if we successfully initialized the fileHandler
+                this->fileHandler->applySettings(this->jobSettings); //apply the background mode, bandwidth limit and threads from settings window
                 bool decrypt = ui.CipherCheckBox->isChecked(); //get state of decrypt checkbox from GUI
                 ui.progressBar->setTextVisible(true); //set the progressBar text to be visible
                 ui.CipherCheckBox->setEnabled(false); //set the cipher checkBox to be unclickable
                 ui.KeyLineEdit->setEnabled(false); //set the key line edit to be unclickable
-                this->setListViewTags(" - Processing.."); //set tags to the items in listView indicating that wiping started
+                this->listViewModel->startJob(decrypt ? ItemOperation::Decrypt : ItemOperation::Encrypt); //set the status of items in listView indicating that encryption/decryption started
+                this->startProgress(); //start sampling the progress of job
                 this->fileHandler->initCipher(key, decrypt); //call our initCipher method to initiate encryption/decryption on specified files
             }
             else //if we failed to initialize fileHandler we show error message
                 this->showMessageBox("Failed Establishing Process", "Error, Couldn't establish process request. Please try again.", "critical");
         }
     }
-    else if (this->fileHandler == NULL && this->fileDictionary.empty()) { //if user didn't choose files we show messagebox with error
+    else if (this->fileHandler == NULL && !this->listViewModel->hasQueuedItems()) { //if user didn't choose files we show messagebox with error
         if (this->wipe) //if we're wiping
             this->showMessageBox("No Files Chosen Error", "Error, Please choose files before starting wipe.", "critical");
         else { //else we encrypt/decrypt
@@ -307,6 +333,8 @@ void CryptoShredder::processFiles() {
  * @brief Method to open the file dialog for choosing files for wipe.
  */
 void CryptoShredder::openFileDialog() {
+    if (this->isLoadingFiles()) //if true chosen files are still loading
+        return; //finish the method's work
     if (this->fileHandler == NULL) {
         QString desktopPath = QDir::homePath() + "/Desktop"; //we set a QString to point to the desktop directory 
         //set the file dialog with appropriate settings for our wiping
@@ -314,50 +342,14 @@ void CryptoShredder::openFileDialog() {
 
         //check if files were selected
         if (!selectedFiles.isEmpty()) {
-            bool isMaxFiles = false; //flag for indicating that user added more then the maximum files allowed
-            int MaxNumOfFiles; //represents the maximum allowed files to wipe at once
-            bool isMaxFileSize = false; //flag for indicating files exceeds maximum size allowed
-            qint64 MaxFileSize; //represents the maximum allowed file size
-            if (this->wipe) {
-                this->setListViewTags(" - Finished", " - Wiped Successfully"); //set previous files tags that were wiped to finished 
-                MaxNumOfFiles = 20; //set max number of files to 20
-                MaxFileSize = 600LL * 1024LL * 1024LL; // set max file size to 600MB
-            }
-            else {
-                this->setListViewTags(" - Finished", " - Encrypted Successfully"); //set previous files tags that were encrypted to finished 
-                this->setListViewTags(" - Finished", " - Decrypted Successfully"); //set previous files tags that were decrypted to finished 
-                MaxNumOfFiles = 10; //set max number of files to 10
-                MaxFileSize = 20LL * 1024LL * 1024LL; // set max file size to 20MB
-            }
-            for (const QString& filePath : selectedFiles) { //we process the selected file paths
-                QFileInfo fileInfo(filePath); //get info about the file
-                if (this->fileCounter >= MaxNumOfFiles) //if true we exceeded the maximum files allowed
-                    isMaxFiles = true; //set isMaxFiles flag to true
-                if (fileInfo.size() > MaxFileSize) //if file exceeds maximum allowed size
-                    isMaxFileSize = true; //set isMaxFileSize flag to true indicating user added large file
-                else { //else file is below maximum size we proccess it
-                    string FilePath = filePath.toStdString(); //save file path in a string variable
-                    filesystem::path p(FilePath); //call filesystem path method to get name of file
-                    QString fileName = QString::fromStdString(p.stem().string() + p.extension().string()); //save name of file in QString variable for GUI
-                    auto dictIterator = this->fileDictionary.find(fileName.toStdString()); //we check if the file already exists in our file dictionary
-                    if (dictIterator == this->fileDictionary.end()) { //if true and our dictIterator points to the end of dictionary it means the file is not in dictionary
-                        if (isMaxFiles) //if isMaxFiles flag is set
-                            break; //break from the loop
-                        this->addItemToListView((fileName.size() > 34) ? QString::fromStdString(p.stem().string().substr(0, 30) + "..." + p.extension().string()) : fileName); //add the file name to our FileListView in GUI
-                        this->fileDictionary[fileName.toStdString()] = this->listViewCounter; //add the file name as the key and the counter representing its index in the listView as value
-                        this->listViewFileDictionary[this->listViewCounter] = FilePath; //add the file to listViewFileDictionary for later use in file viewer
-                        this->filePathList.push_back(filePath.toStdString()); //add each file path to out filePathList
-                        this->listViewCounter++; //increase listView counter
-                        this->fileCounter++; //increase file counter
-                    }
-                }
-            }
-            if (isMaxFileSize && isMaxFiles) //if both flags are set we show messagebox with combined message indicating that both file size and number of files were exceeded
-                this->showMessageBox("Maximum File Size And Maximum Number Of Files Exceeded", "Files larger than " + QString::number(MaxFileSize / (qint64)(1024 * 1024)) + "MB were detected and cannot be added, also the maximum allowed number of files (limited to " + QString::number(MaxNumOfFiles) + " files) has also been exceeded.", "information");
-            else if (isMaxFileSize) //if isMaxFileSize flag is set we show messagebox that notifies the user for a file that exceeded allowed file size
-                this->showMessageBox("Maximum File Size", "Files larger then " + QString::number(MaxFileSize / (qint64)(1024 * 1024)) + "MB detected, files that exceed the limit were not added.", "information");
-            else if (isMaxFiles) //if isMaxFiles flag is set we show messagebox that notifies the user he exceeded the allowed number of files for wipe
-                this->showMessageBox("Maximum Number Of Files Exceeded", "The maximum allowed number of files is limited to " + QString::number(MaxNumOfFiles) + " files at a time.", "information");
+            this->loadingPaths.clear(); //clear the paths of previous load
+            for (const QString& filePath : selectedFiles) //convert each selected file path
+                this->loadingPaths.push_back(filePath.toStdString());
+            ui.ChooseFilesButton->setEnabled(false); //files are added once their metadata is loaded
+            this->metadataThread = thread([this]() {
+                MetadataLoader::Load(this->loadingPaths, this->loadingMetadata); //load the metadata of all selected files at once
+                this->signal->sendSignalMetadataLoaded(); //emit a signal to GUI to add the loaded files
+            });
         }
         else { //else we show messagebox indicating that user didn't choose files
             if (this->wipe) //if we're wiping
@@ -383,17 +375,88 @@ void CryptoShredder::openFileDialog() {
 }
 
 
+/**
+ * @brief Method that is called when metadata of chosen files was loaded, adds the files to listView.
+ * @brief Chosen files have no count or size limit, same as files found in chosen folders, large files are split and small files are batched by the job.
+ * @brief Metadata of added files is kept with their paths and passed to the fileHandler of job.
+ */
+void CryptoShredder::metadataLoaded() {
+    if (!this->metadataThread.joinable()) //if true there's no load to finish
+        return;
+    this->metadataThread.join(); //loader thread already sent its signal
+    ui.ChooseFilesButton->setEnabled(true); //user can choose files again
+    this->listViewModel->archiveResults(); //set previous files that finished successfully to finished
+    vector<string> addedPaths; //represents the paths of files we add to listView, they're inserted as one batch
+    for (size_t i = 0; i < this->loadingPaths.size(); i++) { //we process the selected file paths
+        const string& FilePath = this->loadingPaths[i]; //represents the file path as a string
+        if (!this->listViewModel->isQueued(FilePath)) { //if true the file is not queued yet, files are keyed by full path so same names in different folders don't collide
+            addedPaths.push_back(FilePath); //add the file path to the batch of listView
+            this->filePathList.push_back(FilePath); //add each file path to out filePathList
+            this->fileMetadataList.push_back(this->loadingMetadata[i]); //keep the loaded metadata of file so the job doesn't load it again
+        }
+    }
+    this->listViewModel->addItems(addedPaths); //add the files to our FileListView in GUI at once
+    this->loadingPaths.clear(); //paths of load were added
+    this->loadingMetadata.clear();
+}
+
+
+/**
+ * @brief Method for checking if metadata of chosen files is still loading, shows a messagebox if it is.
+ * @brief Files, folders, mode and settings can't change until the loaded files are added.
+ */
+bool CryptoShredder::isLoadingFiles() {
+    if (!this->metadataThread.joinable()) //if true no files are loading
+        return false;
+    this->showMessageBox("Loading Files", "Error, please wait for chosen files to finish loading.", "warning"); //show messagebox with error
+    return true;
+}
+
+
+/**
+ * @brief Method for choosing a folder, its files and the files of its subfolders are found and processed when the job starts.
+ */
+void CryptoShredder::openFolderDialog() {
+    if (this->isLoadingFiles()) //if true chosen files are still loading
+        return; //finish the method's work
+    if (this->fileHandler == NULL) {
+        QString desktopPath = QDir::homePath() + "/Desktop"; //we set a QString to point to the desktop directory 
+        QString folderPath = QFileDialog::getExistingDirectory(nullptr, "Select Folder", desktopPath); //show the folder dialog
+
+        //check if a folder was selected
+        if (!folderPath.isEmpty()) {
+            string FolderPath = folderPath.toStdString(); //save folder path in a string variable
+            if (!this->listViewModel->isQueued(FolderPath)) { //if true the folder is not queued yet
+                this->listViewModel->archiveResults(); //set previous files that finished successfully to finished
+                this->listViewModel->addItems({ FolderPath }, true); //add the folder to our FileListView in GUI, its name is shown with a trailing separator
+                this->folderPathList.push_back(FolderPath); //add the folder path to our folderPathList
+            }
+        }
+    }
+    else { //else we show messagebox indicating user cannot add folders while wipe in process
+        if (this->wipe) //if we're wiping
+            this->showMessageBox("Wipe In Progress Error", "Error, cannot add folders while wipe in progress.", "warning");
+        else { //else we encrypt/decrypt
+            if (!ui.CipherCheckBox->isChecked()) //if true we show messagebox for encryption
+                this->showMessageBox("Encryption In Progress Error", "Error, cannot add folders while encryption in progress.", "warning");
+            else //else we show messagebox for decryption
+                this->showMessageBox("Decryption In Progress Error", "Error, cannot add folders while decryption in progress.", "warning");
+        }
+    }
+}
+
+
 /**
  * @brief Method to clear the listView items.
  */
 void CryptoShredder::clearContents() {
+    if (this->isLoadingFiles()) //if true chosen files are still loading, they're added when the load finishes
+        return; //finish the method's work
     if (this->fileHandler == NULL) { //means there's no wipe in progress
         this->filePathList.clear(); //clear filePathList
-        this->fileDictionary.clear(); //clear file dictionary
-        this->listViewFileDictionary.clear(); //clear listView file dictionary
-        this->listViewCounter = 0; //set the listViewCounter back to zero
-        this->fileCounter = 0; //set the fileCounter back to zero
-        this->listViewModel->setStringList(QStringList()); //clear current listView items
+        this->fileMetadataList.clear(); //clear fileMetadataList
+        this->folderPathList.clear(); //clear folderPathList
+        this->listViewModel->clear(); //clear current listView items
     }
     else { //else we can't clear the screen
         if (this->wipe) //if we're wiping
@@ -436,10 +499,10 @@ void CryptoShredder::cancelProcess() {
 void CryptoShredder::doubleClickedFile(const QModelIndex& index) {
     if (this->fileHandler == NULL) { //if true we can open file for viewing
         int fileIndex = index.row(); //get fileIndex in integer
-        string filePath = this->listViewFileDictionary[fileIndex]; //get file path from the listView file dictionary
-        filesystem::path p(filePath); //call filesystem path method to get name of file
-        QString fileName = QString::fromStdString(p.stem().string() + p.extension().string()); //get file name with filesystem
-        this->fileViewer = FileViewer::getInstance(this, QString::fromStdString(filePath), (fileName.size() > 34) ? QString::fromStdString(p.stem().string().substr(0, 30) + "..." + p.extension().string()) : fileName); //create a new instance of fileViewer to show file's content to user
+        if (this->listViewModel->isFolder(fileIndex)) //if true the item is a folder, there's no content to view
+            return; //finish the method's work
+        string filePath(this->listViewModel->getPath(fileIndex)); //get file path from the listView model
+        this->fileViewer = FileViewer::getInstance(this, filePath, QString::fromStdString(FileListModel::DisplayName(filePath))); //create a new instance of fileViewer to show file's content to user
     }
     else { //else wipe in progress
         if (this->wipe) //if we're wiping
@@ -454,6 +517,23 @@ void CryptoShredder::doubleClickedFile(const QModelIndex& index) {
 }
 
 
+/**
+ * @brief Method for showing the menu of file in listView, while a job runs a single file can be canceled and the other files continue.
+ * @param QPoint position
+ */
+void CryptoShredder::showFileMenu(const QPoint& position) {
+    QModelIndex index = ui.FileListView->indexAt(position); //represents the item under cursor
+    if (this->fileHandler == NULL || !index.isValid() || this->listViewModel->isFolder(index.row())) //if true there's no file of running job to cancel
+        return; //finish the method's work
+    QMenu fileMenu(this); //represents the menu of file
+    QAction* cancelAction = fileMenu.addAction("Cancel File"); //represents the action that cancels the file
+    if (fileMenu.exec(ui.FileListView->viewport()->mapToGlobal(position)) == cancelAction) { //if true user chose to cancel the file
+        if (!this->fileHandler || !this->fileHandler->cancelFile(string(this->listViewModel->getPath(index.row())))) //if true the file isn't part of running job
+            this->showMessageBox("Unable To Cancel File", "Error, the chosen file isn't part of current process.", "warning"); //show messagebox with error
+    }
+}
+
+
 /**
  * @brief Method to check if key is valid AES key in GUI.
  */
@@ -494,10 +574,25 @@ void CryptoShredder::infoLabelClicked() {
 }
 
 
+/**
+ * @brief Method to open the settings window, settings replace the backend of files so they can't change while a process runs.
+ */
+void CryptoShredder::settingsLabelClicked() {
+    if (this->isLoadingFiles()) //if true chosen files are loading through the backend of files
+        return; //finish the method's work
+    if (this->fileHandler) //if true there's a process in progress
+        this->showMessageBox("Unable To Open Settings", "Error, cannot change settings while current process in progress.", "warning"); //show error messagebox
+    else //else we can open the settings
+        SettingsWindow::getInstance(this, this->jobSettings); //create new instance of SettingsWindow, it deletes itself when closed
+}
+
+
 /**
  * @brief Method for handling operation modes selection in GUI.
  */
 void CryptoShredder::optionsLabelClicked() {
+    if (this->isLoadingFiles()) //if true chosen files are still loading with the limits of current mode
+        return; //finish the method's work
     if (this->fileHandler) { //if true there's a process in progress
         this->showMessageBox("Unable To Change Mode", "Error, cannot change operation mode while current process in progress.", "warning"); //show error messagebox
     }
@@ -4,13 +4,17 @@
 #include <QFileDialog>
 #include <QStringList>
 #include <QLineEdit>
-#include <QStringListModel>
+#include <QTimer>
+#include <QElapsedTimer>
+#include <QMenu>
 #include <unordered_map>
 #include "ui_CryptoShredder.h"
 #include "FileHandler.h"
+#include "FileListModel.h"
 #include "FileViewer.h"
 #include "ImageLabel.h"
 #include "InfoWindow.h"
+#include "SettingsWindow.h"
 
 using namespace std;
 
@@ -24,19 +28,36 @@ private:
     Ui::CryptoShredder ui; //ui element for GUI
     static bool wipe; //flag for indication operation mode, if true we wipe, else we encrypt/decrypt
     static bool isClosing; //flag for indicating that program is about to close
-    QStringListModel* listViewModel = NULL; //model for listView
+    FileListModel* listViewModel = NULL; //model for listView, holds the chosen files and folders with their status
     QRegExpValidator* keyValidator = NULL; //regular expression validator for KeyLineEdit
     FileHandler* fileHandler = NULL; //shredder object for wipe
-    unordered_map<string, int> fileDictionary; //fileDictionary that represents each file with its corresponding index in listView
-    unordered_map<int, string> listViewFileDictionary; //listViewDictionary represents the current files that are showing in FileListView
+    JobSettings jobSettings; //represents the settings of jobs chosen in settings window, applied to each new fileHandler
     vector<string> filePathList; //vector that represents all the files path
+    vector<FileMetadata> fileMetadataList; //vector that represents the metadata of each file in filePathList, loaded when files were chosen
+    vector<string> folderPathList; //vector that represents the paths of chosen folders, their files are found when the job starts
     SignalProxy* signal = NULL; //signal object for foreigner classes to communicate with GUI
     recursive_mutex GUIMutex; //mutex for thread-safe operations
-    size_t listViewCounter = 0; //counter for number of items in listView
-    size_t fileCounter = 0; //counter for number of files
     FileViewer* fileViewer = NULL; //FileViewer object for file viewer 
     ImageLabel* infoImageLabel = NULL; //ImageLabel for info icon
     ImageLabel* optionsImageLabel = NULL; //ImageLabel for options icon
+    ImageLabel* settingsImageLabel = NULL; //ImageLabel for settings icon
+    QTimer* progressTimer = NULL; //timer that samples the byte progress of job at a fixed rate
+    QElapsedTimer progressClock; //clock for measuring the time between progress samples
+    qint64 lastProgressTime = 0; //represents the time of last progress sample in milliseconds
+    size_t lastProgressBytes = 0; //represents the amount of bytes done at last progress sample
+    double throughput = 0; //represents the smoothed throughput of job in bytes per second
+    size_t filesDone = 0; //represents the amount of files of job that finished, counted from drained events
+    size_t lastProgressFiles = 0; //represents the amount of files done at last progress sample
+    double fileRate = 0; //represents the smoothed rate of job in files per second
+    vector<FileUpdate> fileUpdates; //buffer for the listView updates of each drain, reused so drains don't allocate
+    thread metadataThread; //thread that loads the metadata of chosen files so GUI stays responsive, joinable while it loads
+    vector<string> loadingPaths; //represents the paths of chosen files whose metadata is loading
+    vector<FileMetadata> loadingMetadata; //represents the metadata of chosen files, filled by metadataThread
+    static constexpr int ProgressInterval = 33; //interval of progress timer in milliseconds, about 30 updates per second
+    static constexpr double SmoothingFactor = 0.1; //weight of newest sample in smoothed rates, keeps ETA steady at high sample rate
+    void startProgress();
+    size_t applyFileEvents();
+    bool isLoadingFiles();
 
 public:
     CryptoShredder(QWidget* parent = nullptr);
@@ -47,15 +68,17 @@ private slots: //here we declare the slot methods
     void processFiles();
     void cancelProcess();
     void openFileDialog();
+    void metadataLoaded();
+    void openFolderDialog();
     void clearContents();
-    void addItemToListView(const QString& item);
-    void updateListView(const QString& fileDictionaryName, const QString& fileName, const QString& tag);
-    void checkThreads();
-    void setListViewTags(const QString& tag, const QString& currentTag=NULL);
+    void jobFinished();
+    void updateProgress();
     void doubleClickedFile(const QModelIndex& index);
+    void showFileMenu(const QPoint& position);
     void checkLineEditValidator();
     QMessageBox::StandardButton showMessageBox(const QString& title, const QString& text, const QString& type);
     void infoLabelClicked();
     void optionsLabelClicked();
+    void settingsLabelClicked();
     void cipherCheckBoxClicked();
 };
\ No newline at end of file
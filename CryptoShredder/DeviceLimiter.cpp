@@ -0,0 +1,184 @@
+#include "DeviceLimiter.h"
+#include <filesystem>
+#include <fstream>
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#include <winioctl.h>
+#elif defined(__linux__)
+#include <sys/sysmacros.h>
+#endif
+
+
+/**
+ * @brief Method for querying the profile of device that holds given file.
+ * @brief On Linux the device number is mapped to its block device in /sys/dev/block, partitions use the queue of their disk.
+ * @brief On Windows the volume of file is queried for seek penalty and bus type. On Linux the queue depth is also bounded by the request queue of disk.
+ * @param unsigned long long device
+ * @param path filePath
+ */
+DeviceProfile DeviceLimiter::queryProfile([[maybe_unused]] unsigned long long device, [[maybe_unused]] const filesystem::path& filePath) {
+	DeviceProfile profile; //represents the profile of device
+#ifdef _WIN32
+	wchar_t volumePath[MAX_PATH] = {}; //represents the mount point of volume
+	wchar_t volumeName[MAX_PATH] = {}; //represents the volume GUID path
+	if (GetVolumePathNameW(filePath.c_str(), volumePath, MAX_PATH) && GetVolumeNameForVolumeMountPointW(volumePath, volumeName, MAX_PATH)) { //if true we found the volume of file
+		wstring volumeDevice(volumeName); //represents the volume device path
+		if (!volumeDevice.empty() && volumeDevice.back() == L'\\') //device can't be opened with trailing backslash
+			volumeDevice.pop_back();
+		HANDLE volumeHandle = CreateFileW(volumeDevice.c_str(), 0, FILE_SHARE_READ | FILE_SHARE_WRITE, NULL, OPEN_EXISTING, 0, NULL); //open the volume only for queries
+		if (volumeHandle != INVALID_HANDLE_VALUE) { //if true we opened the volume
+			STORAGE_PROPERTY_QUERY query{}; //represents the property query
+			query.QueryType = PropertyStandardQuery;
+			DWORD bytesReturned = 0; //represents the size of returned data
+			DEVICE_SEEK_PENALTY_DESCRIPTOR seekPenalty{}; //represents the seek penalty of device
+			query.PropertyId = StorageDeviceSeekPenaltyProperty;
+			if (DeviceIoControl(volumeHandle, IOCTL_STORAGE_QUERY_PROPERTY, &query, sizeof(query), &seekPenalty, sizeof(seekPenalty), &bytesReturned, NULL)) { //if true we know if device seeks
+				profile.isKnown = true;
+				profile.isRotational = seekPenalty.IncursSeekPenalty != 0;
+			}
+			STORAGE_ADAPTER_DESCRIPTOR adapter{}; //represents the adapter of device
+			query.PropertyId = StorageAdapterProperty;
+			if (DeviceIoControl(volumeHandle, IOCTL_STORAGE_QUERY_PROPERTY, &query, sizeof(query), &adapter, sizeof(adapter), &bytesReturned, NULL)) //if true we know the bus of device
+				profile.isNVMe = adapter.BusType == BusTypeNvme;
+			CloseHandle(volumeHandle); //close the volume
+		}
+	}
+	size_t hardwareQueues = this->nvmeMaxStreams; //Windows doesn't expose hardware queues, NVMe gets the maximal streams
+	size_t deviceRequests = 0; //Windows doesn't expose the request queue of device
+#elif defined(__linux__)
+	char sysPath[64]; //represents the sysfs path of device number
+	snprintf(sysPath, sizeof(sysPath), "/sys/dev/block/%u:%u", major((dev_t)device), minor((dev_t)device));
+	error_code error; //represents the error of filesystem operations, devices without sysfs entry are unknown
+	filesystem::path devicePath = filesystem::canonical(sysPath, error); //resolve the block device of file
+	if (!error && !filesystem::exists(devicePath / "queue", error)) //if true the device is a partition, its disk holds the queue
+		devicePath = devicePath.parent_path();
+	size_t hardwareQueues = 0; //represents the amount of hardware queues of device
+	size_t deviceRequests = 0; //represents the amount of requests the queue of device holds, zero if unknown
+	ifstream rotational(devicePath / "queue" / "rotational"); //open the rotational flag of device
+	char flag = 0; //represents the rotational flag
+	if (!error && rotational.get(flag)) { //if true we know if device is rotational
+		profile.isKnown = true;
+		profile.isRotational = flag == '1';
+		profile.isNVMe = devicePath.filename().string().rfind("nvme", 0) == 0; //NVMe block devices are named nvmeXnY
+		for (filesystem::directory_iterator queueIt(devicePath / "mq", error), end; !error && queueIt != end; queueIt.increment(error))
+			hardwareQueues++; //count the hardware queues of device
+		ifstream requests(devicePath / "queue" / "nr_requests"); //open the size of request queue of device
+		requests >> deviceRequests; //stays zero if it can't be read
+	}
+#else
+	size_t hardwareQueues = 0; //no device information on this platform
+	size_t deviceRequests = 0;
+#endif
+	if (profile.isRotational) { //spinning disks get sequential streams
+		profile.maxStreams = this->rotationalStreams;
+		profile.queueDepth = this->rotationalQueueDepth;
+	}
+	else if (profile.isNVMe) { //NVMe gets a stream per hardware queue
+		profile.maxStreams = min(max(hardwareQueues, this->solidStateStreams), this->nvmeMaxStreams);
+		profile.queueDepth = this->nvmeQueueDepth;
+	}
+	else { //solid state and unknown devices
+		profile.maxStreams = this->solidStateStreams;
+		profile.queueDepth = this->solidStateQueueDepth;
+	}
+	if (deviceRequests > 0) //if true we don't queue more requests than device holds
+		profile.queueDepth = min(profile.queueDepth, deviceRequests);
+	DeviceLimiter::SetStreamDepth(profile); //split the queue depth between streams
+	return profile;
+}
+
+
+/**
+ * @brief Function for splitting the queue depth of device between its streams, each stream keeps at least one request in flight.
+ * @param DeviceProfile profile
+ */
+void DeviceLimiter::SetStreamDepth(DeviceProfile& profile) {
+	profile.streamDepth = max(profile.queueDepth / max(profile.maxStreams, (size_t)1), (size_t)1); //represents the share of each stream
+}
+
+
+/**
+ * @brief Method for adding a device before its tasks are submitted, queries the profile once for each device.
+ * @param unsigned long long device
+ * @param path filePath
+ */
+void DeviceLimiter::addDevice(unsigned long long device, const filesystem::path& filePath) {
+	{
+		lock_guard<mutex> lock(this->deviceMutex); //lock the mutex for devices
+		if (this->devices.count(device)) //if true we already know this device
+			return;
+	}
+	DeviceProfile profile = this->queryProfile(device, filePath); //query the device without holding the lock
+	lock_guard<mutex> lock(this->deviceMutex); //lock the mutex for devices
+	this->devices.try_emplace(device).first->second.profile = profile; //save the profile of device
+}
+
+
+/**
+ * @brief Method for submitting a task of device, the task runs now if device has a free stream, otherwise it waits in device queue.
+ * @param unsigned long long device
+ * @param function<void()> task
+ */
+void DeviceLimiter::submit(unsigned long long device, function<void()> task) {
+	{
+		lock_guard<mutex> lock(this->deviceMutex); //lock the mutex for devices
+		auto [deviceIt, isNew] = this->devices.try_emplace(device); //get the queue of device
+		if (isNew) { //if true the device wasn't added, we use the solid state limits
+			deviceIt->second.profile.maxStreams = this->solidStateStreams;
+			deviceIt->second.profile.queueDepth = this->solidStateQueueDepth;
+			DeviceLimiter::SetStreamDepth(deviceIt->second.profile);
+		}
+		DeviceQueue& deviceQueue = deviceIt->second; //represents the queue of device
+		if (deviceQueue.running >= deviceQueue.profile.maxStreams) { //if true the device is busy
+			deviceQueue.waiting.push_back(move(task)); //the task waits for a free stream
+			return;
+		}
+		deviceQueue.running++; //take a stream of device
+	}
+	this->dispatch(device, move(task)); //run the task on the thread pool
+}
+
+
+/**
+ * @brief Method for submitting a task to the thread pool, releases the stream of device when the task finishes.
+ * @param unsigned long long device
+ * @param function<void()> task
+ */
+void DeviceLimiter::dispatch(unsigned long long device, function<void()> task) {
+	this->threadPool->submit([this, device, task = move(task)]() {
+		task(); //run the task
+		this->finish(device); //release the stream or start the next waiting task
+	});
+}
+
+
+/**
+ * @brief Method for finishing a task of device, next waiting task takes its stream.
+ * @param unsigned long long device
+ */
+void DeviceLimiter::finish(unsigned long long device) {
+	function<void()> nextTask; //represents the next waiting task
+	{
+		lock_guard<mutex> lock(this->deviceMutex); //lock the mutex for devices
+		DeviceQueue& deviceQueue = this->devices[device]; //represents the queue of device
+		if (deviceQueue.waiting.empty()) { //if true nothing waits for this device
+			deviceQueue.running--; //release the stream
+			return;
+		}
+		nextTask = move(deviceQueue.waiting.front()); //take the next task, it keeps the stream
+		deviceQueue.waiting.pop_front();
+	}
+	this->dispatch(device, move(nextTask)); //run the next task on the thread pool
+}
+
+
+/**
+ * @brief Method for getting the profile of device, returns default profile if device wasn't added.
+ * @param unsigned long long device
+ */
+DeviceProfile DeviceLimiter::getProfile(unsigned long long device) {
+	lock_guard<mutex> lock(this->deviceMutex); //lock the mutex for devices
+	auto deviceIt = this->devices.find(device); //find the device
+	return (deviceIt != this->devices.end()) ? deviceIt->second.profile : DeviceProfile();
+}
\ No newline at end of file
@@ -0,0 +1,80 @@
+#ifndef _DeviceLimiter_H
+#define _DeviceLimiter_H
+#define _CRT_SECURE_NO_WARNINGS
+#include <iostream>
+#include <string.h>
+#include <vector>
+#include <deque>
+#include <unordered_map>
+#include <functional>
+#include <filesystem>
+#include <mutex>
+#include "ThreadPool.h"
+
+using namespace std;
+
+/**
+ * @brief Struct that represents the properties of a storage device and the amount of streams we run on it.
+ */
+struct DeviceProfile {
+	bool isKnown = false; //flag for indicating that we could query the device
+	bool isRotational = false; //flag for indicating that device is a spinning disk
+	bool isNVMe = false; //flag for indicating that device is an NVMe drive
+	size_t maxStreams = 1; //represents the maximal amount of tasks that run on device at the same time
+	size_t queueDepth = 4; //represents the maximal amount of requests that streams of device keep in flight together
+	size_t streamDepth = 4; //represents the maximal amount of requests that each stream keeps in flight, its share of queue depth
+};
+
+
+/**
+ * @brief Class that limits the amount of concurrent tasks on each storage device.
+ * @brief Rotational disks get one sequential stream so parallel writers don't turn into seeks, solid state devices get several,
+ * @brief and NVMe devices get one stream per hardware queue up to the pool size. Tasks over the limit wait in the device queue
+ * @brief and are submitted to the thread pool when a task of same device finishes, so workers never block on a busy device.
+ * @brief Each device also has a queue depth that its streams share, so a spinning disk gets one read ahead of its write
+ * @brief and faster devices get enough requests in flight to keep their queues busy without queuing more than they hold.
+ */
+class DeviceLimiter {
+private:
+	/**
+	 * @brief Struct that represents the state of one device.
+	 */
+	struct DeviceQueue {
+		DeviceProfile profile; //represents the profile of device
+		deque<function<void()>> waiting; //represents the tasks that wait for a free stream
+		size_t running = 0; //represents the amount of tasks of device in the thread pool
+	};
+
+	unordered_map<unsigned long long, DeviceQueue> devices; //represents the queue of each device
+	mutex deviceMutex; //mutex for thread-safe access to devices
+	ThreadPool* threadPool = NULL; //represents the pool that runs the tasks
+	size_t rotationalStreams = 1; //represents the amount of streams for rotational disks
+	size_t solidStateStreams = 4; //represents the amount of streams for solid state and unknown devices
+	size_t nvmeMaxStreams = 8; //represents the maximal amount of streams for NVMe devices
+	size_t rotationalQueueDepth = 2; //represents the queue depth of rotational disks
+	size_t solidStateQueueDepth = 16; //represents the queue depth of solid state and unknown devices
+	size_t nvmeQueueDepth = 32; //represents the queue depth of NVMe devices
+	static void SetStreamDepth(DeviceProfile& profile);
+	DeviceProfile queryProfile(unsigned long long device, const filesystem::path& filePath);
+	void dispatch(unsigned long long device, function<void()> task);
+	void finish(unsigned long long device);
+
+public:
+	void setThreadPool(ThreadPool* pool) { this->threadPool = pool; }
+	void addDevice(unsigned long long device, const filesystem::path& filePath);
+	void submit(unsigned long long device, function<void()> task);
+	DeviceProfile getProfile(unsigned long long device);
+	size_t getRotationalStreams() { return this->rotationalStreams; }
+	void setRotationalStreams(size_t number) { this->rotationalStreams = max(number, (size_t)1); }
+	size_t getSolidStateStreams() { return this->solidStateStreams; }
+	void setSolidStateStreams(size_t number) { this->solidStateStreams = max(number, (size_t)1); }
+	size_t getNVMeMaxStreams() { return this->nvmeMaxStreams; }
+	void setNVMeMaxStreams(size_t number) { this->nvmeMaxStreams = max(number, (size_t)1); }
+	size_t getRotationalQueueDepth() { return this->rotationalQueueDepth; }
+	void setRotationalQueueDepth(size_t number) { this->rotationalQueueDepth = max(number, (size_t)1); }
+	size_t getSolidStateQueueDepth() { return this->solidStateQueueDepth; }
+	void setSolidStateQueueDepth(size_t number) { this->solidStateQueueDepth = max(number, (size_t)1); }
+	size_t getNVMeQueueDepth() { return this->nvmeQueueDepth; }
+	void setNVMeQueueDepth(size_t number) { this->nvmeQueueDepth = max(number, (size_t)1); }
+};
+#endif
\ No newline at end of file
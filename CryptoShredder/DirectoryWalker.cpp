@@ -0,0 +1,167 @@
+#include "DirectoryWalker.h"
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#include "Utf8.h"
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <dirent.h>
+#ifdef __linux__
+#include <sys/syscall.h>
+#endif
+#endif
+
+
+#ifdef __linux__
+/**
+ * @brief Struct that represents an entry returned by getdents64.
+ */
+struct LinuxDirent64 {
+	unsigned long long d_ino; //represents the inode of entry
+	long long d_off; //represents the offset of next entry
+	unsigned short d_reclen; //represents the size of this entry
+	unsigned char d_type; //represents the type of entry, DT_UNKNOWN if file system doesn't fill it
+	char d_name[1]; //represents the null terminated name of entry
+};
+#endif
+
+
+/**
+ * @brief Function for reading a directory, adds its subdirectories and regular files to given vectors.
+ * @brief On Linux reads the entries with getdents64 into a large buffer, on Windows uses the basic find information with large fetch.
+ * @brief Returns false if directory can't be opened.
+ * @param Directory directory
+ * @param vector<Directory> subdirectories
+ * @param vector<WalkedFile> files
+ */
+bool DirectoryWalker::ReadDirectory(const Directory& directory, vector<Directory>& subdirectories, vector<WalkedFile>& files) {
+	string prefix = directory.path; //represents the prefix of entry paths
+	if (!prefix.empty() && prefix.back() != '/' && prefix.back() != '\\') //if true we add separator after directory path
+		prefix += '/';
+#ifdef _WIN32
+	WIN32_FIND_DATAW findData{}; //represents the current entry
+	HANDLE findHandle = FindFirstFileExW(Utf8::ToWide(prefix + "*").c_str(), FindExInfoBasic, &findData, FindExSearchNameMatch, NULL, FIND_FIRST_EX_LARGE_FETCH); //start listing directory, skip short names and fetch many entries per call
+	if (findHandle == INVALID_HANDLE_VALUE) //if true we failed opening the directory
+		return false;
+	do {
+		if (wcscmp(findData.cFileName, L".") == 0 || wcscmp(findData.cFileName, L"..") == 0) //if true entry is the directory itself or its parent
+			continue;
+		if (findData.dwFileAttributes & FILE_ATTRIBUTE_REPARSE_POINT) //if true entry is a link or junction, we don't follow it
+			continue;
+		if (findData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) //if true entry is a subdirectory
+			subdirectories.push_back({ prefix + Utf8::FromWide(findData.cFileName), directory.root });
+		else if (!(findData.dwFileAttributes & FILE_ATTRIBUTE_DEVICE)) //else entry is a regular file
+			files.push_back({ prefix + Utf8::FromWide(findData.cFileName), directory.root });
+	} while (FindNextFileW(findHandle, &findData));
+	FindClose(findHandle); //close the listing
+	return true;
+#else
+	int directoryFd = openat(AT_FDCWD, directory.path.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC | O_NOFOLLOW); //open the directory without following links
+	if (directoryFd < 0) //if true we failed opening the directory
+		return false;
+
+	//add an entry by the type the listing gave us, only entries of unknown type are stat'ed relative to the open directory
+	auto addEntry = [&](const char* name, unsigned char type) {
+		if (strcmp(name, ".") == 0 || strcmp(name, "..") == 0) //if true entry is the directory itself or its parent
+			return;
+		if (type == DT_UNKNOWN) { //if true file system didn't give the type, we stat only this entry
+			struct stat entryStat {}; //represents the status of entry
+			if (fstatat(directoryFd, name, &entryStat, AT_SYMLINK_NOFOLLOW) != 0) //if true entry vanished or can't be queried
+				return;
+			type = S_ISDIR(entryStat.st_mode) ? DT_DIR : S_ISREG(entryStat.st_mode) ? DT_REG : DT_UNKNOWN; //set the type from status
+		}
+		if (type == DT_DIR) //if true entry is a subdirectory
+			subdirectories.push_back({ prefix + name, directory.root });
+		else if (type == DT_REG) //else if entry is a regular file
+			files.push_back({ prefix + name, directory.root });
+	};
+
+#ifdef __linux__
+	alignas(8) char buffer[64 * 1024]; //represents the buffer of entries, large so each call returns many entries
+	long bytesRead = 0; //represents the amount of bytes returned by getdents64
+	while ((bytesRead = syscall(SYS_getdents64, directoryFd, buffer, sizeof(buffer))) > 0) { //read the next entries of directory
+		for (long position = 0; position < bytesRead;) { //iterate over the entries in buffer
+			LinuxDirent64* entry = (LinuxDirent64*)(buffer + position); //represents the current entry
+			position += entry->d_reclen; //advance to next entry
+			addEntry(entry->d_name, entry->d_type); //add the entry
+		}
+	}
+	close(directoryFd); //close the directory
+#else
+	DIR* directoryStream = fdopendir(directoryFd); //create directory stream that owns the descriptor
+	if (directoryStream == NULL) { //if true we failed creating the stream
+		close(directoryFd); //close the directory
+		return false;
+	}
+	for (dirent* entry = readdir(directoryStream); entry != NULL; entry = readdir(directoryStream)) //iterate over the entries of directory
+		addEntry(entry->d_name, entry->d_type); //add the entry
+	closedir(directoryStream); //close the directory stream and its descriptor
+#endif
+	return true;
+#endif
+}
+
+
+/**
+ * @brief Method of each walker, reads directories from the shared stack until the stack is empty and no walker can add more.
+ * @param function<void(vector<WalkedFile>&)> onFiles
+ * @param function<bool()> isCanceled
+ */
+void DirectoryWalker::walkerLoop(const function<void(vector<WalkedFile>&)>& onFiles, const function<bool()>& isCanceled) {
+	vector<WalkedFile> files; //represents the files found by this walker that weren't passed to callback yet
+	vector<Directory> subdirectories; //represents the subdirectories of current directory
+	while (true) {
+		Directory directory; //represents the directory we read next
+		{
+			unique_lock<mutex> lock(this->walkMutex); //lock the mutex for directories
+			this->walkCondition.wait(lock, [this]() { return !this->directories.empty() || this->activeWalkers == 0; }); //wait for a directory or for the walk to end
+			if (this->directories.empty()) //if true no walker is reading and nothing is left, the walk ended
+				break;
+			directory = move(this->directories.back()); //take the directory from top of stack, depth first keeps the stack small
+			this->directories.pop_back();
+			this->activeWalkers++; //we're reading a directory, so more directories may come
+		}
+		if (!isCanceled || !isCanceled()) //if true the walk wasn't canceled so we read the directory
+			ReadDirectory(directory, subdirectories, files); //directories we can't open are skipped
+		{
+			lock_guard<mutex> lock(this->walkMutex); //lock the mutex for directories
+			for (Directory& subdirectory : subdirectories) //add the subdirectories to stack
+				this->directories.push_back(move(subdirectory));
+			this->activeWalkers--; //we finished reading the directory
+		}
+		subdirectories.clear(); //clear the subdirectories for next directory
+		this->walkCondition.notify_all(); //wake walkers for new directories or for the end of walk
+		if (files.size() >= this->batchSize) { //if true we pass the batch to callback
+			onFiles(files); //pass the files, callback runs without holding the lock
+			files.clear(); //start a new batch
+		}
+	}
+	if (!files.empty()) //if true we pass the files that are left
+		onFiles(files);
+}
+
+
+/**
+ * @brief Method for walking given root folders, blocks until all folders were read. Calls onFiles with batches of found files.
+ * @brief The calling thread is one of the walkers. If isCanceled returns true the walkers stop reading new directories.
+ * @param vector<string> roots
+ * @param function<void(vector<WalkedFile>&)> onFiles
+ * @param function<bool()> isCanceled
+ */
+void DirectoryWalker::walk(const vector<string>& roots, const function<void(vector<WalkedFile>&)>& onFiles, const function<bool()>& isCanceled) {
+	{
+		lock_guard<mutex> lock(this->walkMutex); //lock the mutex for directories
+		this->directories.clear(); //clear previous walk
+		this->activeWalkers = 0; //no walker is reading yet
+		for (size_t i = 0; i < roots.size(); i++) //add each root to stack
+			this->directories.push_back({ roots[i], i });
+	}
+	vector<thread> walkers; //represents the other walker threads
+	for (size_t i = 1; i < this->numOfWalkers; i++)
+		walkers.emplace_back(&DirectoryWalker::walkerLoop, this, cref(onFiles), cref(isCanceled)); //start each walker
+	this->walkerLoop(onFiles, isCanceled); //calling thread walks too
+	for (thread& walker : walkers) //wait for the other walkers
+		walker.join();
+}
\ No newline at end of file
@@ -0,0 +1,56 @@
+#ifndef _DirectoryWalker_H
+#define _DirectoryWalker_H
+#define _CRT_SECURE_NO_WARNINGS
+#include <iostream>
+#include <string.h>
+#include <vector>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+using namespace std;
+
+/**
+ * @brief Struct that represents a regular file found by the walker.
+ */
+struct WalkedFile {
+	string path; //represents the UTF-8 path of file
+	size_t root = 0; //represents the index of root folder the file was found under
+};
+
+
+/**
+ * @brief Class that walks directory trees with several threads at the same time.
+ * @brief Walkers share a stack of directories, each walker reads a whole directory and pushes its subdirectories back on the stack,
+ * @brief so wide trees are read in parallel. The type of each entry comes from the directory listing so no entry is stat'ed,
+ * @brief only entries of unknown type fall back to a stat. Symbolic links and other special files are skipped.
+ * @brief Found files are passed in batches to the callback as they're found, the callback may run on several walkers at the same time.
+ */
+class DirectoryWalker {
+private:
+	/**
+	 * @brief Struct that represents a directory that waits to be read.
+	 */
+	struct Directory {
+		string path; //represents the UTF-8 path of directory
+		size_t root = 0; //represents the index of root folder of directory
+	};
+
+	vector<Directory> directories; //represents the stack of directories that wait to be read
+	size_t activeWalkers = 0; //represents the amount of walkers that read a directory right now
+	mutex walkMutex; //mutex for thread-safe access to directories
+	condition_variable walkCondition; //condition for waking idle walkers
+	size_t numOfWalkers = max(thread::hardware_concurrency(), 1u); //represents the amount of walker threads
+	size_t batchSize = 256; //represents the amount of files passed to callback at once
+	void walkerLoop(const function<void(vector<WalkedFile>&)>& onFiles, const function<bool()>& isCanceled);
+	static bool ReadDirectory(const Directory& directory, vector<Directory>& subdirectories, vector<WalkedFile>& files);
+
+public:
+	void walk(const vector<string>& roots, const function<void(vector<WalkedFile>&)>& onFiles, const function<bool()>& isCanceled = nullptr);
+	size_t getNumOfWalkers() { return this->numOfWalkers; }
+	void setNumOfWalkers(size_t number) { this->numOfWalkers = max(number, (size_t)1); }
+	size_t getBatchSize() { return this->batchSize; }
+	void setBatchSize(size_t size) { this->batchSize = max(size, (size_t)1); }
+};
+#endif
\ No newline at end of file
@@ -0,0 +1,115 @@
+#ifndef _EventQueue_H
+#define _EventQueue_H
+#define _CRT_SECURE_NO_WARNINGS
+#include <iostream>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+using namespace std;
+
+/**
+ * @brief Lock-free bounded multi-producer/single-consumer queue used to pass events from workers to GUI thread.
+ * @brief Each slot has a sequence number that tells whether it's free for the producer that claimed it or ready for the consumer,
+ * @brief so producers only race on claiming the tail with one compare-exchange. Capacity is rounded up to a power of two.
+ * @brief Producers that find the queue full sleep until the consumer frees a slot, the consumer only locks when a producer sleeps.
+ */
+template <typename T>
+class EventQueue {
+private:
+	/**
+	 * @brief Struct that represents one slot of queue.
+	 */
+	struct Slot {
+		atomic<size_t> sequence = 0; //represents the position the slot waits for, position for producers and position + 1 for consumer
+		T item; //represents the item of slot
+	};
+
+	unique_ptr<Slot[]> cells; //represents the slots of queue, not named slots because Qt defines it as a macro
+	size_t mask = 0; //represents the capacity of queue minus one
+	alignas(64) atomic<size_t> tail = 0; //represents the next position to push, shared by producers
+	alignas(64) size_t head = 0; //represents the next position to pop, used only by consumer
+	atomic<size_t> waitingProducers = 0; //represents the amount of producers that sleep until a slot is freed
+	mutex waitMutex; //mutex for sleeping producers
+	condition_variable slotFreed; //condition that wakes a sleeping producer when consumer frees a slot
+
+public:
+	EventQueue(size_t capacity = 1024) { this->setCapacity(capacity); }
+	EventQueue(const EventQueue&) = delete; //prevent copy
+	void operator=(const EventQueue&) = delete; //prevent assignment
+
+	/**
+	 * @brief Method for setting the capacity of queue, drops queued items. Must not run while other threads use the queue.
+	 * @param size_t capacity
+	 */
+	void setCapacity(size_t capacity) {
+		size_t size = 2; //represents the capacity rounded up to a power of two
+		while (size < capacity)
+			size <<= 1;
+		this->cells = make_unique<Slot[]>(size); //create the slots
+		for (size_t i = 0; i < size; i++)
+			this->cells[i].sequence.store(i, memory_order_relaxed); //each slot waits for the producer of its position
+		this->mask = size - 1; //set the mask of positions
+		this->tail.store(0, memory_order_release); //queue starts empty
+		this->head = 0;
+	}
+
+	/**
+	 * @brief Method for pushing an item without waiting, returns false if queue is full. Safe to call from many threads.
+	 * @param T item
+	 */
+	bool tryPush(const T& item) {
+		size_t position = this->tail.load(memory_order_relaxed); //represents the position we try to claim
+		Slot* slot = NULL; //represents the claimed slot
+		while (true) {
+			slot = &this->cells[position & this->mask]; //get the slot of position
+			size_t sequence = slot->sequence.load(memory_order_seq_cst); //get the position the slot waits for, ordered after the count of a sleeping producer
+			long long difference = (long long)sequence - (long long)position; //zero if slot is free for this position
+			if (difference == 0) { //if true the slot is free, we try to claim the position
+				if (this->tail.compare_exchange_weak(position, position + 1, memory_order_relaxed))
+					break;
+			}
+			else if (difference < 0) //if true the consumer didn't pop the slot yet, so queue is full
+				return false;
+			else //else another producer claimed the position, we retry with current tail
+				position = this->tail.load(memory_order_relaxed);
+		}
+		slot->item = item; //save the item in its slot
+		slot->sequence.store(position + 1, memory_order_release); //publish the item to consumer
+		return true;
+	}
+
+	/**
+	 * @brief Method for popping an item without waiting, returns false if queue is empty. Only one thread may pop.
+	 * @param T item
+	 */
+	bool tryPop(T& item) {
+		Slot& slot = this->cells[this->head & this->mask]; //get the slot of head
+		if (slot.sequence.load(memory_order_acquire) != this->head + 1) //if true the item of head wasn't published yet
+			return false;
+		item = slot.item; //take the item from its slot
+		slot.sequence.store(this->head + this->mask + 1, memory_order_seq_cst); //free the slot for the producer of next round, ordered before the check of sleeping producers
+		this->head++; //advance to next position
+		if (this->waitingProducers.load(memory_order_seq_cst) > 0) { //if true a producer sleeps because queue was full
+			lock_guard<mutex> lock(this->waitMutex); //lock so the producer is either waiting or still checking the slots
+			this->slotFreed.notify_one(); //wake one producer for the freed slot
+		}
+		return true;
+	}
+
+	/**
+	 * @brief Method for pushing an item, sleeps until there's a free slot so full queue doesn't keep workers busy.
+	 * @param T item
+	 */
+	void push(const T& item) {
+		if (this->tryPush(item)) //if true there was a free slot
+			return;
+		unique_lock<mutex> lock(this->waitMutex); //lock the mutex for sleeping producers
+		this->waitingProducers.fetch_add(1, memory_order_seq_cst); //count ourself before we check the slots, so consumer either sees us or we see its freed slot
+		this->slotFreed.wait(lock, [this, &item]() { return this->tryPush(item); }); //sleep until the consumer frees a slot and we claim it
+		this->waitingProducers.fetch_sub(1); //we pushed the item
+	}
+};
+#endif
\ No newline at end of file
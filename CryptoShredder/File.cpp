@@ -1,93 +1,106 @@
 #include "File.h"
+#include "IO/PosixBackend.h"
+#include "IO/MmapBackend.h"
+#include "IO/UringBackend.h"
+#include "IO/AlignedBuffer.h"
+#include <algorithm>
 
 
-bool File::isCanceled = false; //initialization of static isCanceled flag
-bool File::isFailed = false; //initialization of static isFailed flag
+/**
+ * @brief Struct that represents a chunk of file held by a pooled buffer of cipher pipeline.
+ */
+struct PipelineChunk {
+    size_t offset = 0; //represents the offset of chunk in file
+    size_t size = 0; //represents the size of chunk
+    bool isWriting = false; //flag for indicating that the request in flight is the write of chunk, else it's the read
+};
+
+
+static PosixBackend posixBackend; //default I/O backend with positional reads and writes
+static PosixBackend directBackend(true); //I/O backend with positional reads and writes that bypass the page cache, falls back to cached I/O where direct I/O isn't supported
+static MmapBackend mmapBackend; //I/O backend that maps the file and ciphers its pages in place
+static UringBackend uringBackend; //I/O backend that queues the requests of each file on io_uring
+IOBackend* File::backend = &posixBackend; //initialization of static backend
 
 
 /**
- * @brief Constructor of class.
+ * @brief Function for getting the backends that can be chosen for files, the first backend is the default.
+ * @brief Backends that don't work on this system are listed too, callers check isAvailable before choosing one.
+ * @brief The backend is shared by all files, so it's only replaced while no job or metadata load is running.
  */
-File::File(const string& filePath, Observer& observer) : Observable() {
-    filesystem::path p(File::ToWString(filePath)); //create path object to get info from filePath
-    if (!exists(p)) { //check if the path exists
-        throw runtime_error("Error, the path: " + filePath + " does not exist."); //if not we throw runtime error
-    }
-    this->name = p.stem().wstring(); //set the name of file
-    this->extention = p.extension().wstring(); //set the extention 
-    this->fullName = p.stem().wstring() + p.extension().wstring(); //set the file full name
-    this->fullPath = p.wstring(); //set full path of file
-    this->length = filesystem::file_size(p); //set the length with file_size method
-    this->addObserver(&observer); //add the observer to observer list
+const vector<IOBackend*>& File::getBackends() {
+    static const vector<IOBackend*> backends = { &posixBackend, &directBackend, &mmapBackend, &uringBackend }; //represents the backends in order of GUI
+    return backends;
 }
 
 
 /**
- * @brief Function to convert from wstring to regular string.
- * @param wstring wstr
+ * @brief Constructor of class. The file keeps a view of filePath, so the path must outlive the file or the file is bound
+ * @brief to the interned copy of path with setPath, FileHandler interns the paths of its files in its registry.
  */
-string File::ToString(const wstring& wstr) {
-    string result = "";
-    for (wchar_t wc : wstr) {
-        if (wc <= 0x7F) {
-            result.push_back((char)wc); //single-byte characters
-        }
-        else if (wc <= 0x7FF) {
-            result.push_back((char)(0xC0 | (wc >> 6))); //first byte for multi-byte characters
-            result.push_back((char)(0x80 | (wc & 0x3F))); //second byte for multi-byte characters
-        }
-        else if (wc <= 0xFFFF) {
-            result.push_back((char)(0xE0 | (wc >> 12))); //first byte for 3-byte characters
-            result.push_back((char)(0x80 | ((wc >> 6) & 0x3F))); //second byte
-            result.push_back((char)(0x80 | (wc & 0x3F))); //third byte
-        }
-        else if (wc <= 0x10FFFF) {
-            result.push_back((char)(0xF0 | (wc >> 18))); //first byte for 4-byte characters
-            result.push_back((char)(0x80 | ((wc >> 12) & 0x3F))); //second byte
-            result.push_back((char)(0x80 | ((wc >> 6) & 0x3F))); //third byte
-            result.push_back((char)(0x80 | (wc & 0x3F))); //fourth byte
-        }
+File::File(string_view filePath, JobToken& job, size_t id) : path(filePath), id(id), job(job) {
+    if (!File::backend->getMetadata(this->getFullPath(), this->metadata)) { //load the metadata with one status call and check if the path exists
+        throw runtime_error("Error, the path: " + string(filePath) + " does not exist."); //if not we throw runtime error
     }
-    return result;
 }
 
 
 /**
- * @brief Function to convert from string to wstring.
- * @param string str
+ * @brief Constructor of class with metadata that was loaded before, so creating the file costs no system call.
+ * @brief The file keeps a view of filePath like the other constructor.
  */
-wstring File::ToWString(const string& str) {
-    wstring result = L"";
-    size_t i = 0;
-    while (i < str.size()) {
-        unsigned char c1 = str[i];
-        if (c1 <= 0x7F) {
-            result.push_back((wchar_t)c1); //single-byte characters
-            ++i;
-        }
-        else if ((c1 >> 5) == 0x6) {
-            unsigned char c2 = str[i + 1];
-            wchar_t wc = ((c1 & 0x1F) << 6) | (c2 & 0x3F); //2-byte character
-            result.push_back(wc);
-            i += 2;
-        }
-        else if ((c1 >> 4) == 0xE) {
-            unsigned char c2 = str[i + 1];
-            unsigned char c3 = str[i + 2];
-            wchar_t wc = ((c1 & 0xF) << 12) | ((c2 & 0x3F) << 6) | (c3 & 0x3F); //3-byte character
-            result.push_back(wc);
-            i += 3;
-        }
-        else if ((c1 >> 3) == 0x1E) {
-            unsigned char c2 = str[i + 1];
-            unsigned char c3 = str[i + 2];
-            unsigned char c4 = str[i + 3];
-            wchar_t wc = ((c1 & 0x7) << 18) | ((c2 & 0x3F) << 12) | ((c3 & 0x3F) << 6) | (c4 & 0x3F); //4-byte character
-            result.push_back(wc);
-            i += 4;
-        }
+File::File(string_view filePath, JobToken& job, const FileMetadata& metadata, size_t id) : path(filePath), metadata(metadata), id(id), job(job) {
+    if (!metadata.exists) { //if true the path didn't exist when metadata was loaded
+        throw runtime_error("Error, the path: " + string(filePath) + " does not exist."); //if not we throw runtime error
     }
-    return result;
+}
+
+
+/**
+ * @brief Function for converting a path of engine to the path type of file system. On Windows the UTF-8 path is transcoded
+ * @brief to UTF-16 for the wide API, elsewhere paths are plain bytes and are passed to the file system as they are.
+ * @param string_view filePath
+ */
+filesystem::path File::NativePath(string_view filePath) {
+#ifdef _WIN32
+    return filesystem::path(Utf8::ToWide(filePath)); //wide API takes UTF-16
+#else
+    return filesystem::path(string(filePath)); //native bytes, no conversion
+#endif
+}
+
+
+/**
+ * @brief Method for getting the name of file with its extension, a view of path after its last separator.
+ */
+string_view File::getFullName() const {
+#ifdef _WIN32
+    size_t separator = this->path.find_last_of("/\\"); //Windows accepts both separators
+#else
+    size_t separator = this->path.find_last_of('/'); //represents the position of last separator
+#endif
+    return (separator == string_view::npos) ? this->path : this->path.substr(separator + 1);
+}
+
+
+/**
+ * @brief Method for getting the extension of file with its dot, empty if name has no dot or only a leading dot.
+ */
+string_view File::getExtention() const {
+    string_view fullName = this->getFullName(); //represents the name of file with its extension
+    size_t dot = fullName.find_last_of('.'); //represents the position of last dot
+    if (dot == string_view::npos || dot == 0 || fullName == "..") //if true name has no extension
+        return string_view();
+    return fullName.substr(dot);
+}
+
+
+/**
+ * @brief Method for getting the name of file without its extension.
+ */
+string_view File::getName() const {
+    string_view fullName = this->getFullName(); //represents the name of file with its extension
+    return fullName.substr(0, fullName.size() - this->getExtention().size());
 }
 
 
@@ -96,8 +109,8 @@ wstring File::ToWString(const string& str) {
  * @param File file
  */
 void File::removeFile(const File& file) {
-    if (_wremove(file.fullPath.c_str()) != 0) { //if true we failed removing file
-        throw runtime_error("Error trying to delete file: " + File::ToString(file.fullPath)); //throw exception with error
+    if (!File::backend->remove(file.getFullPath())) { //if true we failed removing file
+        throw runtime_error("Error trying to delete file: " + string(file.path)); //throw exception with error
     }
 }
 
@@ -108,39 +121,40 @@ void File::removeFile(const File& file) {
  * @param int passes
  * @param bool toRemove
  */
-void File::WipeFile(const File& file, int passes, bool toRemove) {
-    fstream outputFile(file.fullPath, ios::in | ios::out | ios::binary); //open the file in binary mode for reading and writing
-
-    if (!outputFile.is_open() || outputFile.fail()) { //we check if we failed opening the file
-        outputFile.close(); //close the file due to error
-        File::setIsFailed(true); //set isFailed to true to indicate of failure
-        file.notify(false); //notify all observers that we finished the task
+void File::WipeFile(File& file, int passes, bool toRemove) {
+    file.phase = FilePhase::Running; //file is being wiped
+    unique_ptr<IOFile> outputFile = File::backend->open(file.getFullPath()); //open the file with positional writes using current backend
+    if (!outputFile) { //we check if we failed opening the file
+        file.setFailed(FileError::OpenFailed); //save the error of file
+        file.finish(FilePhase::Failed); //report that we finished the task
         return; //finish the function if error occured
     }
+    outputFile->adviseSequential(); //we write the file once from start to end in each pass
 
     try {
         random_device randomDevice; //for random bytes generator
         mt19937_64 generator(randomDevice()); //secure random byte generator
 
-        size_t fileSize = file.length; //set fileSize to be file size in bytes
+        size_t fileSize = file.metadata.size; //set fileSize to be file size in bytes
         size_t currentSize = 0; //set currentSize to be zero to indicate the beginning of file
         size_t chunkSize = 0; //set chunkSize to be zero and later calculate minimal chunk to read
         const size_t maxBufferSize = 1024 * 1024; //set maxBufferSize to be 1MB for efficiency
         size_t bufferSize = min(fileSize, maxBufferSize); //set minimal bufferSize for memory efficiency
-        vector<char> buffer(bufferSize); //create buffer vector based on bufferSize
+        AlignedBuffer buffer(bufferSize); //create aligned buffer based on bufferSize, aligned so it can be used for direct I/O
+        size_t releasedSize = 0; //represents the amount of bytes of current pass that were dropped from page cache
 
         //we iterate in a loop each pass and wipe the file's contents
         for (int pass = 0; pass < passes; pass++) {
-            outputFile.seekp(0); //we start from the beginning of the file each pass
             currentSize = 0; //reset currentSize in each pass to start from beginning
+            releasedSize = 0; //reset releasedSize in each pass
 
             //wiping the file with random data with Mersenne Twister algorithm
             while (currentSize < fileSize) {
                 chunkSize = min(fileSize - currentSize, bufferSize); //set chunkSize based on the minimum between the fileSize - currentSize and bufferSize
 
-                if (File::isCanceled) { //if true we stop the file wipe
-                    outputFile.close(); //close the file for cancelation
-                    file.notify(true); //notify all observers that we finished the task
+                if (file.getIsCanceled()) { //if true we stop the file wipe
+                    outputFile.reset(); //close the file for cancelation
+                    file.finish(FilePhase::Canceled); //report that we finished the task
                     return; //finish the function if we need to cancel
                 }
 
@@ -148,110 +162,360 @@ void File::WipeFile(const File& file, int passes, bool toRemove) {
                 for (size_t i = 0; i < chunkSize; i++)
                     buffer[i] = (unsigned char)(generator() & 0xFF); //generate a random byte and insert it into the buffer
 
-                outputFile.seekp(currentSize); //set cursor in currentSize position for writing
-                outputFile.write(buffer.data(), chunkSize); //write buffer data to the file
-                if (outputFile.fail()) { //if true we failed to write data
-                    outputFile.close(); //close the file due to error
-                    File::setIsFailed(true); //set isFailed to true to indicate of failure
-                    file.notify(false); //notify all observers that we finished the task
+                file.acquireBandwidth(chunkSize); //wait until the bandwidth cap allows the write
+                if (!outputFile->writeAt(buffer.data(), chunkSize, currentSize)) { //write buffer data at currentSize position, if true we failed to write data
+                    outputFile.reset(); //close the file due to error
+                    file.setFailed(FileError::WriteFailed); //save the error of file
+                    file.finish(FilePhase::Failed); //report that we finished the task
                     return; //finish the function if error occured
                 }
 
-                outputFile.flush(); //flush the file 
+                file.addProgress(chunkSize); //add the written bytes to progress of file and job
                 currentSize += chunkSize; //add chunkSize to currentSize for indication to point where we need to write more data in next iteration
+                File::ReleaseBehind(*outputFile, releasedSize, currentSize); //drop the written pages behind us so the wipe doesn't fill the page cache
+            }
+
+            if (!outputFile->sync()) { //flush the pass to storage device so each pass reaches the device, if true we failed
+                outputFile.reset(); //close the file due to error
+                file.setFailed(FileError::WriteFailed); //save the error of file
+                file.finish(FilePhase::Failed); //report that we finished the task
+                return; //finish the function if error occured
             }
         }
 
-        outputFile.close(); //after we finish we close the file
-        if (toRemove) //if true we need to remove the file
+        if (!outputFile->release(0, fileSize)) { //evict what's left of the file from page cache, if true we failed writing it back
+            outputFile.reset(); //close the file due to error
+            file.setFailed(FileError::WriteFailed); //save the error of file
+            file.finish(FilePhase::Failed); //report that we finished the task
+            return; //finish the function if error occured
+        }
+        outputFile.reset(); //after we finish we close the file
+        if (toRemove) { //if true we need to remove the file
+            file.phase = FilePhase::Removing; //file is being removed
             removeFile(file); //call removeFile function to remove the file
-        file.notify(true); //notify all observers that we finished the task
+        }
+        file.finish(FilePhase::Finished); //report that we finished the task
     }
     catch (const exception& e) { //catch exceptions that may be thrown
-        outputFile.close(); //close the file due to error
-        File::setIsFailed(true); //set isFailed to true to indicate of failure
-        file.notify(false); //notify all observers that we finished the task
+        outputFile.reset(); //close the file due to error
+        file.setFailed((file.phase == FilePhase::Removing) ? FileError::RemoveFailed : FileError::WriteFailed); //save the error of file
+        file.finish(FilePhase::Failed); //report that we finished the task
         return; //finish the function if error occured
     }
 }
 
 
+/**
+ * @brief Function for deriving the AES key and initialization vector from given key.
+ * @param string key
+ * @param vector<unsigned char> keyVec
+ * @param vector<unsigned char> ivVec
+ */
+void File::DeriveCipherKeys(const string& key, vector<unsigned char>& keyVec, vector<unsigned char>& ivVec) {
+    keyVec.assign(key.begin(), key.end()); //save the given key in vector
+    ivVec.assign(keyVec.begin(), keyVec.begin() + 16); //create a initialization vector with first 16 bytes of given keyVec
+    ivVec = AES::Encrypt_ECB(ivVec, keyVec); //we encrypt the initialization vector using AES ECB mode with given key
+    //apply XOR operation between encrypted ivVec and keyVec
+    for (size_t i = 0; i < ivVec.size(); i++)
+        ivVec[i] ^= keyVec[i]; //XOR between each byte
+}
+
+
 /**
  * @brief Function that handles encryption/decryption on given file using custom AES library.
  * @param File file
  * @param string key
- * @param bool decrypt
  */
-void File::CipherFile(const File& file, const string& key, bool decrypt) {
-    fstream outputFile(file.fullPath, ios::in | ios::out | ios::binary); //open the file in binary mode for reading and writing
-
-    if (!outputFile.is_open() || outputFile.fail()) { //we check if we failed opening the file
-        outputFile.close(); //close the file due to error
-        File::setIsFailed(true); //set isFailed to true to indicate of failure
-        file.notify(false); //notify all observers that we finished the task
-        return; //finish the function if error occured
+void File::CipherFile(File& file, const string& key) {
+    bool result = true; //represents the result of operation
+    file.phase = FilePhase::Running; //file is being ciphered
+    try {
+        result = File::CipherRange(file, key, 0, file.metadata.size); //process the whole file, CTR mode uses same keystream for encryption and decryption
     }
+    catch (const exception& e) { //catch exceptions that may be thrown
+        file.setFailed(FileError::CipherFailed); //save the error of file
+        result = false; //set result to false to indicate of failure
+    }
+    if (!result) //if true the operation failed
+        file.finish(FilePhase::Failed); //report that we finished the task
+    else //else the file was processed or canceled, canceled file didn't write all its bytes
+        file.finish((file.bytesDone >= file.metadata.size) ? FilePhase::Finished : FilePhase::Canceled); //report that we finished the task
+}
 
+
+/**
+ * @brief Function that handles encryption/decryption on a region of given file, used for splitting large files between threads.
+ * @brief Regions start at multiple of CipherChunkSize so the counter of each region starts from the iv like in CipherFile.
+ * @param File file
+ * @param string key
+ * @param size_t offset
+ * @param size_t regionLength
+ */
+void File::CipherRegion(File& file, const string& key, size_t offset, size_t regionLength) {
+    file.phase = FilePhase::Running; //file is being ciphered
     try {
-        size_t fileSize = file.length; //set fileSize to be file size in bytes
-        size_t currentSize = 0; //set currentSize to be zero to indicate the beginning of file
-        size_t chunkSize = 0; //set chunkSize to be zero and later calculate minimal chunk to read
-        const size_t maxBufferSize = 1024 * 1024; //set maxBufferSize to be 1MB for efficiency
-        size_t bufferSize = min(fileSize, maxBufferSize); //set minimal bufferSize for memory efficiency
-        vector<char> buffer(bufferSize); //create buffer vector based on bufferSize
-
-        const vector<unsigned char> keyVec(key.begin(), key.end()); //save the given key in vector
-        vector<unsigned char> ivVec(keyVec.begin(), keyVec.begin() + 16); //create a initialization vector with first 16 bytes of given keyVec
-        ivVec = AES::Encrypt_ECB(ivVec, keyVec); //we encrypt the initialization vector using AES ECB mode with given key
-        //apply XOR operation between encrypted ivVec and keyVec
-        for (size_t i = 0; i < ivVec.size(); i++)
-            ivVec[i] ^= keyVec[i]; //XOR between each byte
-
-        //encrypt or decrypt the file using AES algorithm in CTR mode
-        while (currentSize < fileSize) {
-            chunkSize = min(fileSize - currentSize, bufferSize); //set chunkSize based on the minimum between the fileSize - currentSize and bufferSize
-
-            if (File::isCanceled) { //if true we stop the file wipe
-                outputFile.close(); //close the file for cancelation
-                file.notify(true); //notify all observers that we finished the task
-                return; //finish the function if we need to cancel
-            }
+        File::CipherRange(file, key, offset, regionLength); //process the region, each region opens its own file, failures are saved in status of file
+    }
+    catch (const exception& e) { //catch exceptions that may be thrown
+        file.setFailed(FileError::CipherFailed); //save the error of file
+    }
+    file.finishRegion(); //report that region finished, last region notifies the observers
+}
 
-            outputFile.seekg(currentSize); //set cursor in currentSize position for reading
-            outputFile.read(buffer.data(), chunkSize); //read chunk into our buffer
-            if (outputFile.fail()) { //if true we failed to write data
-                outputFile.close(); //close the file due to error
-                File::setIsFailed(true); //set isFailed to true to indicate of failure
-                file.notify(false); //notify all observers that we finished the task
-                return; //finish the function if error occured
-            }
 
-            vector<unsigned char> processedBuffer(buffer.begin(), buffer.begin() + chunkSize); //create processedBuffer with chunkSize for encryption/decryption
-            if (!decrypt) //if true we encrypt file
-                processedBuffer = AES::Encrypt_CTR(processedBuffer, keyVec, ivVec); //we encrypt using AES CTR mode with given key and iv 
-            else //else we decrypt file
-                processedBuffer = AES::Decrypt_CTR(processedBuffer, keyVec, ivVec); //we decrypt using AES CTR mode with given key and iv 
-
-            outputFile.seekp(currentSize); //set cursor in currentSize position for writing
-            outputFile.write(reinterpret_cast<const char*>(processedBuffer.data()), chunkSize); //write buffer data to the file
-            if (outputFile.fail()) { //if true we failed to write data
-                outputFile.close(); //close the file due to error
-                File::setIsFailed(true); //set isFailed to true to indicate of failure
-                file.notify(false); //notify all observers that we finished the task
-                return; //finish the function if error occured
+/**
+ * @brief Function that handles encryption/decryption on a range of file using the current backend.
+ * @brief Applies the keystream in place if the backend can map the file, otherwise uses the read/cipher/write pipeline.
+ * @brief Both run on the calling worker, so a task never uses more than its own thread.
+ * @brief Returns true if the range was processed or canceled, false on failure, the error is saved in status of file.
+ * @param File file
+ * @param string key
+ * @param size_t offset
+ * @param size_t rangeLength
+ * @throws invalid_argument thrown if given key is invalid.
+ */
+bool File::CipherRange(File& file, const string& key, size_t offset, size_t rangeLength) {
+    unique_ptr<IOFile> ioFile = File::backend->open(file.getFullPath()); //open the file using current backend
+    if (!ioFile) { //if true we failed opening the file
+        file.setFailed(FileError::OpenFailed); //save the error of file
+        return false; //return false indicating of failure
+    }
+    if (rangeLength == 0) //if true there's nothing to process
+        return true;
+    ioFile->adviseSequential(); //we read and write the range once from start to end
+
+    vector<unsigned char> keyVec, ivVec; //represents the AES key and initialization vector
+    File::DeriveCipherKeys(key, keyVec, ivVec); //derive key and iv from given key
+    bool result = true; //represents the result of range operation
+    if (ioFile->map(offset, min(rangeLength, File::CipherChunkSize)) != NULL) //if true the backend gives in-place access to the file
+        result = File::CipherMapped(file, *ioFile, keyVec, ivVec, offset, rangeLength); //apply the keystream directly on the mapped pages
+    else
+        result = File::CipherPipeline(file, *ioFile, keyVec, ivVec, offset, rangeLength); //else we use the read/cipher/write pipeline
+    AES::ClearVector(keyVec); //clear the key for added security after we finish operations
+    AES::ClearVector(ivVec); //clear the iv for added security after we finish operations
+    if (!ioFile->release(offset, rangeLength)) { //evict the range from page cache so no plaintext or ciphertext stays cached, if true we failed writing it back
+        file.setFailed(FileError::WriteFailed); //save the error of file
+        return false; //return false indicating of failure
+    }
+    return result;
+}
+
+
+/**
+ * @brief Function that applies AES CTR keystream in place on a range of file through the backend's mapped windows.
+ * @brief No user-space copy is needed in either direction, each window is written back when the next one is mapped.
+ * @param File file
+ * @param IOFile ioFile
+ * @param vector<unsigned char> keyVec
+ * @param vector<unsigned char> ivVec
+ * @param size_t offset
+ * @param size_t rangeLength
+ */
+bool File::CipherMapped(File& file, IOFile& ioFile, const vector<unsigned char>& keyVec, const vector<unsigned char>& ivVec, size_t offset, size_t rangeLength) {
+    size_t rangeEnd = offset + rangeLength; //represents the end of range
+    size_t releasedOffset = offset; //represents the end of range that was dropped from page cache
+    vector<unsigned char> keystream; //represents the precomputed keystream
+    bool result = true; //represents the result of operation
+    try {
+        keystream = AES::Create_Keystream(min(rangeLength, File::CipherChunkSize), keyVec, ivVec); //every chunk starts from the iv, so one chunk of keystream covers every chunk of range
+        //apply keystream on each chunk of range, each chunk starts from the iv so each chunk uses the same keystream
+        for (size_t currentOffset = offset; currentOffset < rangeEnd; currentOffset += File::CipherChunkSize) {
+            if (file.getIsCanceled()) //if true we stop the file encryption/decryption
+                break; //stop the operation, canceled file is reported as canceled
+            size_t chunkSize = min(rangeEnd - currentOffset, File::CipherChunkSize); //set chunkSize based on the minimum between remaining bytes and CipherChunkSize
+            unsigned char* view = ioFile.map(currentOffset, chunkSize); //get the mapped pages of chunk, maps next window if needed
+            if (view == NULL) { //if true we failed mapping the chunk
+                file.setFailed(FileError::ReadFailed); //save the error of file
+                result = false; //set result to false to indicate of failure
+                break; //write back what we already processed
             }
+            file.acquireBandwidth(2 * chunkSize); //wait until the bandwidth cap allows the page faults and write back of chunk
+            AES::Apply_Keystream(view, keystream.data(), chunkSize); //XOR the keystream directly on the mapped pages
+            file.addProgress(chunkSize); //add the processed bytes to progress of file and job
+            File::ReleaseBehind(ioFile, releasedOffset, currentOffset + chunkSize); //write back and drop the processed pages behind us
+        }
+    }
+    catch (const exception& e) { //catch exceptions that may be thrown
+        file.setFailed(FileError::CipherFailed); //save the error of file
+        result = false; //set result to false to indicate of failure
+    }
+    AES::ClearVector(keystream); //clear the keystream for added security after we finish operations
+    if (!ioFile.unmap() && result) { //write back the last window, if true we failed
+        file.setFailed(FileError::WriteFailed); //save the error of file
+        result = false; //set result to false to indicate of failure
+    }
+    return result;
+}
+
 
-            outputFile.flush(); //flush the file 
-            currentSize += chunkSize; //add chunkSize to currentSize for indication to point where we need to write more data in next iteration
+/**
+ * @brief Function that handles encryption/decryption on a range of file with reads and writes queued on the backend.
+ * @brief Each pooled buffer holds one chunk that is read, ciphered in place and written back, then it's reused for the next chunk.
+ * @brief With a backend that keeps several requests in flight, reading the next chunks and writing the previous ones overlap
+ * @brief with the XOR of current chunk on the calling worker, without starting other threads. Range must start at multiple of CipherChunkSize.
+ * @brief The keystream is generated while the first reads are in flight, so the cipher step is only a XOR.
+ * @brief If the backend can't wait for its requests, the pooled buffers are kept because requests in flight may still use them.
+ * @param File file
+ * @param IOFile ioFile
+ * @param vector<unsigned char> keyVec
+ * @param vector<unsigned char> ivVec
+ * @param size_t offset
+ * @param size_t rangeLength
+ */
+bool File::CipherPipeline(File& file, IOFile& ioFile, const vector<unsigned char>& keyVec, const vector<unsigned char>& ivVec, size_t offset, size_t rangeLength) {
+    size_t rangeEnd = offset + rangeLength; //represents the end of range
+    size_t numOfBuffers = min(file.queueDepth, (rangeLength + File::CipherChunkSize - 1) / File::CipherChunkSize); //represents the amount of pooled buffers, no more than the queue depth of file or chunks of range
+    unique_ptr<vector<AlignedBuffer>> bufferPool = make_unique<vector<AlignedBuffer>>(); //represents the pooled buffers, aligned so they can be used for direct I/O
+    bufferPool->reserve(numOfBuffers);
+    for (size_t i = 0; i < numOfBuffers; i++)
+        bufferPool->emplace_back(min(rangeLength, File::CipherChunkSize)); //create each pooled buffer
+    vector<PipelineChunk> chunks(numOfBuffers); //represents the chunk held by each pooled buffer, the tag of each request is the index of its buffer
+    vector<size_t> writtenAhead; //represents the offsets of chunks that were written before a chunk in front of them
+    vector<unsigned char> keystream; //represents the precomputed keystream
+    size_t nextOffset = offset; //represents the offset of next chunk to read
+    size_t writtenOffset = offset; //represents the end of range that was written without gaps
+    size_t releasedOffset = offset; //represents the end of range that was dropped from page cache
+    size_t inFlight = 0; //represents the amount of queued requests whose completion wasn't taken yet
+    bool isStopped = false; //flag for indicating that a step failed, requests in flight are only drained
+    bool isBroken = false; //flag for indicating that we can't wait for completions, requests in flight may still use the pooled buffers
+    bool result = true; //represents the result of operation
+
+    //queue the read of next chunk of range into given buffer, nothing is queued after cancelation or failure
+    auto submitRead = [&](size_t index) {
+        if (isStopped || nextOffset >= rangeEnd || file.getIsCanceled()) //if true there's no chunk to read
+            return;
+        PipelineChunk& chunk = chunks[index]; //represents the chunk of buffer
+        chunk.offset = nextOffset; //set the offset of chunk
+        chunk.size = min(rangeEnd - nextOffset, File::CipherChunkSize); //set chunk size based on the minimum between remaining bytes and CipherChunkSize
+        chunk.isWriting = false;
+        file.acquireBandwidth(chunk.size); //wait until the bandwidth cap allows the read
+        if (!ioFile.submitRead((*bufferPool)[index].data(), chunk.size, chunk.offset, index)) { //queue the read of chunk, if true we failed
+            file.setFailed(FileError::ReadFailed); //save the error of file
+            result = false; //set result to false to indicate of failure
+            isStopped = true; //stop queuing new requests
+            return;
         }
+        nextOffset += chunk.size; //advance to next chunk
+        inFlight++; //increase the amount of requests in flight
+    };
 
-        outputFile.close(); //after we finish we close the file
-        file.notify(true); //notify all observers that we finished the task
+    for (size_t i = 0; i < numOfBuffers; i++) //queue the first reads, one for each buffer
+        submitRead(i);
+    try {
+        keystream = AES::Create_Keystream(min(rangeLength, File::CipherChunkSize), keyVec, ivVec); //generate the keystream while the first reads are in flight, every chunk starts from the iv
     }
     catch (const exception& e) { //catch exceptions that may be thrown
-        outputFile.close(); //close the file due to error
-        File::setIsFailed(true); //set isFailed to true to indicate of failure
-        file.notify(false); //notify all observers that we finished the task
-        return; //finish the function if error occured
+        file.setFailed(FileError::CipherFailed); //save the error of file
+        result = false; //set result to false to indicate of failure
+        isStopped = true; //the reads in flight are only drained
+    }
+
+    //take each finished request, a read chunk is ciphered and written back and a written buffer reads the next chunk
+    IOCompletion completion; //represents the finished request
+    while (inFlight > 0) {
+        if (!ioFile.complete(completion)) { //wait for next finished request, if true the backend can't wait for its requests
+            file.setFailed(FileError::ReadFailed); //save the error of file
+            result = false; //set result to false to indicate of failure
+            isBroken = true;
+            break;
+        }
+        inFlight--; //decrease the amount of requests in flight
+        PipelineChunk& chunk = chunks[completion.tag]; //represents the chunk of finished request
+        unsigned char* buffer = (*bufferPool)[completion.tag].data(); //represents the buffer of chunk
+        if (!completion.isSuccess) { //if true the request failed
+            file.setFailed(chunk.isWriting ? FileError::WriteFailed : FileError::ReadFailed); //save the error of file
+            result = false; //set result to false to indicate of failure
+            isStopped = true; //stop queuing new requests
+        }
+        else if (isStopped) //else if a step failed, remaining chunks are only drained
+            continue;
+        else if (!chunk.isWriting) { //else the chunk was read, we cipher it and queue its write
+            AES::Apply_Keystream(buffer, keystream.data(), chunk.size); //we encrypt or decrypt in place with AES CTR keystream
+            chunk.isWriting = true;
+            file.acquireBandwidth(chunk.size); //wait until the bandwidth cap allows the write
+            if (!ioFile.submitWrite(buffer, chunk.size, chunk.offset, completion.tag)) { //queue the write of chunk, if true we failed
+                file.setFailed(FileError::WriteFailed); //save the error of file
+                result = false; //set result to false to indicate of failure
+                isStopped = true; //stop queuing new requests
+                continue;
+            }
+            inFlight++; //increase the amount of requests in flight
+        }
+        else { //else the chunk was written, we drop the written range behind us and reuse the buffer
+            file.addProgress(chunk.size); //add the written bytes to progress of file and job
+            writtenAhead.push_back(chunk.offset); //requests may finish in any order, so we advance only over chunks without gaps
+            vector<size_t>::iterator written; //represents the written chunk at end of range without gaps
+            while ((written = find(writtenAhead.begin(), writtenAhead.end(), writtenOffset)) != writtenAhead.end()) { //advance over each chunk that closes the gap
+                writtenAhead.erase(written);
+                writtenOffset = min(writtenOffset + File::CipherChunkSize, rangeEnd); //advance over the written chunk
+            }
+            File::ReleaseBehind(ioFile, releasedOffset, writtenOffset); //write back and drop the written pages behind us
+            submitRead(completion.tag); //read the next chunk into the free buffer
+        }
+    }
+    AES::ClearVector(keystream); //clear the keystream for added security after we finish operations
+    if (isBroken) //if true requests in flight may still read or write the pooled buffers after we return, so we keep them
+        (void)bufferPool.release();
+    return result;
+}
+
+
+/**
+ * @brief Method for reporting that a region of file finished, notifies observers when all regions finished.
+ * @brief A failed region saved its error in status of file, so the whole file is failed.
+ */
+void File::finishRegion() {
+    if (this->pendingRegions.fetch_sub(1) == 1) { //if true this was the last region of file
+        if (this->error != FileError::None) //if true one of the regions failed
+            this->finish(FilePhase::Failed); //report that we finished the task
+        else //else the regions were processed or canceled, canceled file didn't write all its bytes
+            this->finish((this->bytesDone >= this->metadata.size) ? FilePhase::Finished : FilePhase::Canceled); //report that we finished the task
+    }
+}
+
+
+/**
+ * @brief Method for saving the error of file, only the first error is kept. Also marks the job of file as failed.
+ * @param FileError fileError
+ */
+void File::setFailed(FileError fileError) {
+    FileError noError = FileError::None; //represents the expected error of file
+    this->error.compare_exchange_strong(noError, fileError); //save the error only if file has no error yet
+    this->job.setIsFailed(true); //mark the job as failed
+}
+
+
+/**
+ * @brief Method for setting the final phase of file and pushing its event to the queue of job, the GUI drains the queue in batches.
+ * @param FilePhase finalPhase
+ */
+void File::finish(FilePhase finalPhase) {
+    this->phase = finalPhase; //set the final phase of file
+    this->job.getEvents().push({ this->id, finalPhase, this->error.load(), this->bytesDone.load(memory_order_relaxed) }); //push the event of file without locking
+}
+
+
+/**
+ * @brief Method for resetting the status and cancellation token of file before a new job.
+ */
+void File::resetStatus() {
+    this->isCanceled = false; //reset isCanceled flag
+    this->phase = FilePhase::Pending; //file waits for its task
+    this->error = FileError::None; //reset the error of file
+    this->bytesDone = 0; //reset the amount of written bytes
+}
+
+
+/**
+ * @brief Function that writes back and drops from page cache every EvictionWindow behind the write cursor.
+ * @brief The window right behind the cursor is kept so we don't wait on writes that were just issued.
+ * @param IOFile ioFile
+ * @param size_t releasedOffset
+ * @param size_t writeOffset
+ */
+void File::ReleaseBehind(IOFile& ioFile, size_t& releasedOffset, size_t writeOffset) {
+    while (writeOffset - releasedOffset >= 2 * File::EvictionWindow) { //release while there's a full window behind the kept one
+        ioFile.release(releasedOffset, File::EvictionWindow); //write back and drop the window, failures are reported by the final release
+        releasedOffset += File::EvictionWindow; //advance the released offset
     }
 }
\ No newline at end of file
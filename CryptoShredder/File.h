@@ -3,44 +3,87 @@
 #define _CRT_SECURE_NO_WARNINGS
 #include <iostream>
 #include <string.h>
+#include <string_view>
 #include <vector>
-#include <fstream>
 #include <filesystem>
 #include <random>
-#include "Observer.h"
+#include <atomic>
 #include "AES/AES.h"
+#include "IO/IOBackend.h"
+#include "JobToken.h"
+#include "Utf8.h"
 
 using namespace std;
 
+/**
+ * @brief Struct that represents a snapshot of the status of file.
+ */
+struct FileStatus {
+	FilePhase phase = FilePhase::Pending; //represents the phase of file
+	FileError error = FileError::None; //represents the first error of file
+	size_t bytesDone = 0; //represents the amount of bytes written to file by its job
+};
+
 /**
  * @brief Class that represent a File object.
  */
-class File : public Observable {
+class File {
 private:
-	wstring name; //represents file name
-	wstring extention; //represents file extention
-	wstring fullName; //represents file full name
-	wstring fullPath; //represents file path
-	size_t length; //represents file length
-	static bool isCanceled; //static flag for canceled wipe
-    static bool isFailed; //static flag for failed operation
+	string_view path; //represents the native byte path of file, UTF-8 on Windows, interned by the registry of its job
+	FileMetadata metadata; //represents the size, identity and allocation of file, loaded once when file is created
+	size_t id; //represents the id of file in its job, sent with its events
+	JobToken& job; //represents the job of file, shared with the other files of job
+	atomic<bool> isCanceled = false; //flag for canceling only this file
+	atomic<FilePhase> phase = FilePhase::Pending; //represents the phase of file
+	atomic<FileError> error = FileError::None; //represents the first error of file
+	atomic<size_t> bytesDone = 0; //represents the amount of bytes written to file by its job
+	atomic<size_t> pendingRegions = 0; //represents the amount of regions of file that are still in process
+	size_t queueDepth = PipelineDepth; //represents the amount of requests that each task of file keeps in flight, set from the queue depth of its device
+	static IOBackend* backend; //static I/O backend used by wipe and cipher operations
+	static void DeriveCipherKeys(const string& key, vector<unsigned char>& keyVec, vector<unsigned char>& ivVec);
+	static bool CipherRange(File& file, const string& key, size_t offset, size_t rangeLength);
+	static bool CipherMapped(File& file, IOFile& ioFile, const vector<unsigned char>& keyVec, const vector<unsigned char>& ivVec, size_t offset, size_t rangeLength);
+	static bool CipherPipeline(File& file, IOFile& ioFile, const vector<unsigned char>& keyVec, const vector<unsigned char>& ivVec, size_t offset, size_t rangeLength);
+	static void ReleaseBehind(IOFile& ioFile, size_t& releasedOffset, size_t writeOffset);
+	void acquireBandwidth(size_t bytes) { this->job.getThrottle().acquire(bytes); }
+	void addProgress(size_t bytes) { this->bytesDone.fetch_add(bytes, memory_order_relaxed); this->job.addProgress(bytes); }
 
 public:
-	File(const string& filePath, Observer& observer);
+	static constexpr size_t CipherChunkSize = 1024 * 1024; //size of each CTR chunk, the counter starts from the iv at each chunk
+	static constexpr size_t PipelineDepth = 4; //maximal amount of pooled buffers of cipher pipeline, each buffer has one read or write in flight
+	static constexpr size_t EvictionWindow = 8 * 1024 * 1024; //size of each range dropped from page cache behind the write cursor
+	File(string_view filePath, JobToken& job, size_t id=0);
+	File(string_view filePath, JobToken& job, const FileMetadata& metadata, size_t id=0);
 	virtual ~File() {}
-	static string ToString(const wstring& wstr);
-	static wstring ToWString(const string& str);
+	static filesystem::path NativePath(string_view filePath);
 	static void removeFile(const File& file);
-	static void WipeFile(const File& file, int passes=1, bool toRemove=false);
-	static void CipherFile(const File& file, const string& key, bool decrypt=false);
-	wstring getName() { return this->name; }
-	wstring getExtention() { return this->extention; }
-	wstring getFullName() { return this->fullName; }
-	wstring getFullPath() { return this->fullPath; }
-	size_t getLength() { return this->length; }
-	static bool getIsCanceled() { return isCanceled; }
-	static void setIsCanceled(bool state) { isCanceled = state; }
-    static bool getIsFailed() { return isFailed; }
-    static void setIsFailed(bool state) { isFailed = state; }
+	static void WipeFile(File& file, int passes=1, bool toRemove=false);
+	static void CipherFile(File& file, const string& key);
+	static void CipherRegion(File& file, const string& key, size_t offset, size_t regionLength);
+	void finishRegion();
+	void setFailed(FileError fileError);
+	void finish(FilePhase finalPhase);
+	void setPhase(FilePhase filePhase) { this->phase = filePhase; }
+	string_view getName() const;
+	string_view getExtention() const;
+	string_view getFullName() const;
+	filesystem::path getFullPath() const { return File::NativePath(this->path); }
+	string_view getPath() const { return this->path; }
+	void setPath(string_view filePath) { this->path = filePath; }
+	size_t getLength() const { return this->metadata.size; }
+	const FileMetadata& getMetadata() const { return this->metadata; }
+	size_t getId() { return this->id; }
+	void setId(size_t fileId) { this->id = fileId; }
+	void setPendingRegions(size_t regions) { this->pendingRegions = regions; }
+	size_t getQueueDepth() const { return this->queueDepth; }
+	void setQueueDepth(size_t depth) { this->queueDepth = min(max(depth, (size_t)1), File::PipelineDepth); }
+	FileStatus getStatus() const { return { this->phase.load(), this->error.load(), this->bytesDone.load(memory_order_relaxed) }; }
+	void resetStatus();
+	void cancel() { this->isCanceled.store(true, memory_order_release); }
+	bool getIsCanceled() const { return this->isCanceled.load(memory_order_acquire) || this->job.getIsCanceled(); }
+	JobToken& getJob() { return this->job; }
+	static const vector<IOBackend*>& getBackends();
+	static IOBackend* getBackend() { return backend; }
+	static void setBackend(IOBackend* ioBackend) { backend = ioBackend; }
 };
 #endif
\ No newline at end of file
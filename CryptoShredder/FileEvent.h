@@ -0,0 +1,56 @@
+#ifndef _FileEvent_H
+#define _FileEvent_H
+#define _CRT_SECURE_NO_WARNINGS
+#include <iostream>
+#include <string.h>
+#include <string_view>
+
+using namespace std;
+
+/**
+ * @brief Enum that represents the phase of file in its job.
+ */
+enum class FilePhase {
+	Pending, //file is waiting for its task
+	Running, //file is being wiped or ciphered
+	Removing, //file was wiped and is being removed
+	Finished, //file finished successfully
+	Canceled, //file was stopped by cancelation
+	Failed //file failed, error tells why
+};
+
+/**
+ * @brief Enum that represents the error of failed file.
+ */
+enum class FileError {
+	None, //no error
+	OpenFailed, //failed opening the file
+	ReadFailed, //failed reading from file
+	WriteFailed, //failed writing to file, includes flushing it to device
+	RemoveFailed, //failed removing the file after wipe
+	CipherFailed //failed creating the keystream, for example invalid key
+};
+
+/**
+ * @brief Struct that represents the event of a file that finished, pushed by workers and drained on GUI thread.
+ */
+struct FileEvent {
+	size_t fileId = 0; //represents the id of file in its job
+	FilePhase phase = FilePhase::Pending; //represents the final phase of file
+	FileError error = FileError::None; //represents the first error of file
+	size_t bytesDone = 0; //represents the amount of bytes written to file by its job
+};
+
+/**
+ * @brief Struct that represents the change of a chosen file or folder in GUI, made from file events when they're drained.
+ * @brief Updates of a drain are applied to the listView together, the path is a view of the path in FileHandler.
+ */
+struct FileUpdate {
+	string_view path; //represents the full path of chosen file or folder
+	FilePhase phase = FilePhase::Pending; //represents the final phase of file, unused for folders
+	bool isFolder = false; //flag for indicating that update holds the counts of a folder
+	size_t finished = 0; //represents the amount of files of folder that finished successfully
+	size_t failed = 0; //represents the amount of files of folder that failed
+	size_t canceled = 0; //represents the amount of files of folder that were canceled
+};
+#endif
\ No newline at end of file
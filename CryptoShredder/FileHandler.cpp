@@ -2,21 +2,26 @@
 
 
 /**
- * @brief Constructor of class.
+ * @brief Constructor of class. Files of given folders are found while the job runs.
+ * @brief Metadata of chosen files is loaded by the caller when they're chosen, metadataList[i] belongs to filePathList[i].
  */
-FileHandler::FileHandler(const vector<string> filePathList, SignalProxy* signal) : Observer() {
-	this->fileDictionarySize = filePathList.size(); //set the size of the fileDictionaryList
+FileHandler::FileHandler(const vector<string> filePathList, const vector<FileMetadata>& metadataList, SignalProxy* signal, const vector<string> folderPathList) {
 	this->signal = signal; //set the signal object for GUI update
+	for (const string& folderPath : folderPathList) //iterate over the chosen folders
+		this->folderRoots.push_back({ folderPath }); //add each folder as a root of walk
+	size_t eventCapacity = this->folderRoots.empty() ? filePathList.size() : max(filePathList.size(), StreamEventCapacity); //represents the capacity of event queue, files of folders aren't counted yet so workers may wait for the GUI
+	this->job.getEvents().setCapacity(eventCapacity); //each chosen file pushes one event per job, so workers never wait for the GUI
+	this->registry.reserve(filePathList.size()); //reserve the registry for chosen files
 	try {
-		for (int i = 0; i < this->fileDictionarySize; i++) { //iterate over filePathList and file Dictionary
-			File* file = new File(filePathList[i], *this); //we create a new file with each filePath it the filePathList 
-			wstring fileName = file->getFullName(); //we create new key for the dictionary that will represent the file name and extention
-			this->fileDictionary[fileName] = file; //we add the file to the dictionary with the key being the file name including its extention
-		}
+		if (metadataList.size() != filePathList.size()) //if true metadata of some chosen files is missing
+			throw runtime_error("Error, metadata of chosen files is missing."); //throw runtime error
+		for (size_t i = 0; i < filePathList.size(); i++) //iterate over filePathList
+			this->addFile(new File(filePathList[i], this->job, metadataList[i]), NoRoot); //we create a new file with each filePath in the filePathList and add it to registry
 	}
 	catch (const exception& e) { //catch a runtime error that might be thrown
 		this->signal->sendSignalMessageBox("Error", e.what(), "critical"); //show a messagebox with error in GUI
 	}
+	this->numOfChosenFiles = this->fileList.size(); //set the amount of chosen files
 }
 
 
@@ -24,88 +29,393 @@ FileHandler::FileHandler(const vector<string> filePathList, SignalProxy* signal)
  * @brief Destructor of class.
  */
 FileHandler::~FileHandler() {
-	for (const auto& [fileName, file] : this->fileDictionary) { //we iterate over fileDictionary 
+	if (this->walkerThread.joinable()) //if true the walk of last job may still submit tasks
+		this->walkerThread.join(); //wait for the walk to end
+	this->job.getThrottle().release(); //wake workers that wait for bandwidth
+	this->threadPool.reset(); //join the workers before we delete the files they use
+	for (File* file : this->fileList) { //we iterate over fileList
 		delete file; //delete each file that we finished wiping
 	}
 }
 
 
 /**
- * @brief Method to initiate the file threads and start wipe process on given files.
+ * @brief Function for getting the name of folder item in GUI, the folder name followed by a separator.
+ * @param string folderPath
+ */
+string FileHandler::FolderName(const string& folderPath) {
+	size_t end = folderPath.find_last_not_of("/\\"); //represents the position of last character of folder name, trailing separators are ignored
+	if (end == string::npos) //if true the folder is the root of file system
+		return "/";
+	size_t start = folderPath.find_last_of("/\\", end); //represents the position of separator before folder name
+	start = (start == string::npos) ? 0 : start + 1; //folder name starts after the separator
+	return folderPath.substr(start, end - start + 1) + "/";
+}
+
+
+/**
+ * @brief Method for setting the background mode of job, in background mode each worker lowers its I/O class and nice value when it starts.
+ * @brief The mode applies to workers of the thread pool, so changing it recreates the pool on next job.
+ * @param bool state
+ * @param IOClass ioClass
+ * @param int ioLevel
+ * @param int niceValue
+ */
+void FileHandler::setBackgroundMode(bool state, ThreadPriority::IOClass ioClass, int ioLevel, int niceValue) {
+	if (this->isJobRunning()) //if true we can't replace the workers of running job
+		return;
+	this->backgroundMode = state; //set backgroundMode flag
+	this->backgroundIOClass = ioClass; //set the I/O class
+	this->backgroundIOLevel = ioLevel; //set the I/O level
+	this->backgroundNice = niceValue; //set the nice value
+	this->threadPool.reset(); //workers are created with their priority, so next job creates a new pool
+}
+
+
+/**
+ * @brief Method for applying the settings of GUI to next job, settings of workers take effect when the pool is created.
+ * @param JobSettings settings
+ */
+void FileHandler::applySettings(const JobSettings& settings) {
+	if (this->isJobRunning()) //if true we can't change the settings of running job
+		return;
+	this->setBackgroundMode(settings.backgroundMode); //background mode uses the idle I/O class and default nice value
+	this->setBandwidthLimit(settings.bandwidthLimit);
+	this->setPoolSize(settings.poolSize);
+	this->setWorkersPerFile(settings.workersPerFile);
+	this->setSplitThreshold(settings.splitThreshold);
+	this->threadPool.reset(); //next job creates the pool with its new size
+}
+
+
+/**
+ * @brief Method for starting a new job, creates the thread pool if needed and resets the job future.
+ * @brief Pending tasks start from one so the job can't finish while its tasks are still being submitted.
+ */
+void FileHandler::startJob() {
+	if (this->walkerThread.joinable()) //if true the walk of previous job ended but wasn't joined
+		this->walkerThread.join();
+	if (!this->threadPool) { //if true we create the pool with current pool size
+		function<void()> workerStart; //represents the function that prepares each worker, empty in normal mode
+		if (this->backgroundMode) //if true each worker lowers its own priority
+			workerStart = [ioClass = this->backgroundIOClass, ioLevel = this->backgroundIOLevel, niceValue = this->backgroundNice]() { ThreadPriority::SetBackground(ioClass, ioLevel, niceValue); };
+		this->threadPool = make_unique<ThreadPool>(this->poolSize, workerStart);
+	}
+	this->job.reset(); //reset the cancellation and failure flags of job
+	this->job.getThrottle().setRate(this->bandwidthLimit * 1024 * 1024); //set the bandwidth cap of job, zero disables it
+	for (File* file : this->fileList) //iterate over the files of job
+		file->resetStatus(); //reset the status and cancellation token of file
+	for (FolderRoot& root : this->folderRoots) { //iterate over the chosen folders
+		root.finished = root.failed = root.canceled = 0; //reset the counts of folder
+		root.isDirty = false;
+	}
+	this->deviceLimiter.setThreadPool(this->threadPool.get()); //device limiter submits the tasks to our pool
+	this->jobPromise = promise<void>(); //create new promise for the job
+	this->jobFuture = this->jobPromise.get_future().share(); //save the future of job
+	this->pendingTasks = 1; //hold the job open until all tasks are submitted
+}
+
+
+/**
+ * @brief Method for submitting a task of current job, the device limiter passes it to the thread pool when the device has a free stream.
+ * @param unsigned long long device
+ * @param function<void()> task
+ */
+void FileHandler::submitTask(unsigned long long device, function<void()> task) {
+	this->pendingTasks++; //increase the amount of pending tasks
+	this->deviceLimiter.submit(device, [this, task = move(task)]() {
+		task(); //run the task
+		this->finishTask(); //mark the task as finished
+	});
+}
+
+
+/**
+ * @brief Method for marking a task of current job as finished, last task fulfills the job future and notifies the GUI.
+ */
+void FileHandler::finishTask() {
+	if (--this->pendingTasks == 0) { //if true all tasks of job finished
+		this->jobPromise.set_value(); //fulfill the job future
+		this->signal->sendSignalJobFinished(); //emit a signal to GUI to indicate that job has finished
+	}
+}
+
+
+/**
+ * @brief Method for planning the tasks of job from the files in fileDictionary.
+ */
+void FileHandler::planJob() {
+	vector<File*> files(this->fileList.begin(), this->fileList.begin() + this->numOfChosenFiles); //represents the chosen files of job, files of folders are planned while they're found
+	this->planner.plan(files); //plan the tasks, duplicates of same inode are processed once
+	for (const PlannedTask& task : this->planner.getTasks()) //iterate over the planned tasks
+		this->deviceLimiter.addDevice(task.device, task.files.front()->getFullPath()); //query the profile of each device once
+}
+
+
+/**
+ * @brief Method for walking the chosen folders while the job runs, found files are streamed into the planner in batches
+ * @brief and each task is passed to submitPlanned as soon as it's ready, so workers start before the walk ends.
+ * @brief The walk holds the job open until its last tasks are submitted.
+ * @param function<void(const PlannedTask&)> submitPlanned
+ */
+void FileHandler::walkFolders(function<void(const PlannedTask&)> submitPlanned) {
+	if (this->folderRoots.empty()) //if true there are no folders to walk
+		return;
+	vector<string> roots; //represents the paths of chosen folders
+	for (const FolderRoot& root : this->folderRoots) //iterate over the chosen folders
+		roots.push_back(root.path);
+	this->pendingTasks++; //hold the job open until the walk ends
+	this->walkerThread = thread([this, roots = move(roots), submitPlanned = move(submitPlanned)]() {
+		vector<PlannedTask> readyTasks; //represents the tasks that are left when the walk ends
+		try {
+			this->walker.walk(roots, [this, &submitPlanned](vector<WalkedFile>& walkedFiles) {
+				vector<string> paths; //represents the paths of batch
+				for (WalkedFile& walkedFile : walkedFiles) //take the paths of batch
+					paths.push_back(move(walkedFile.path));
+				vector<FileMetadata> metadata; //represents the metadata of batch
+				MetadataLoader::Load(paths, metadata, 1); //load the metadata of batch on this walker, walkers already run in parallel
+				vector<File*> files; //represents the files of batch
+				vector<size_t> fileRoots; //represents the folder root of each file of batch
+				for (size_t i = 0; i < paths.size(); i++) { //create the files without holding the lock
+					if (!metadata[i].exists) //if true file vanished since it was listed, we skip it
+						continue;
+					files.push_back(new File(paths[i], this->job, metadata[i])); //create the file, its id and interned path are set when it's added to registry
+					fileRoots.push_back(walkedFiles[i].root); //save the folder root of file
+				}
+				vector<PlannedTask> tasks; //represents the tasks that are ready after this batch
+				{
+					lock_guard<mutex> lock(this->fileMutex); //lock the mutex for files and planner
+					size_t numOfFiles = 0; //represents the amount of files that are new to job
+					for (size_t i = 0; i < files.size(); i++) { //add the files to job
+						if (this->addFile(files[i], fileRoots[i])) //if true the path is new, otherwise file was deleted
+							files[numOfFiles++] = files[i];
+					}
+					files.resize(numOfFiles); //keep the new files
+					this->planner.stream(files, tasks); //plan the files, other names of inodes planned before become aliases
+				}
+				for (const PlannedTask& task : tasks) //submit the ready tasks without holding the lock
+					submitPlanned(task);
+			}, [this]() { return this->job.getIsCanceled(); });
+			lock_guard<mutex> lock(this->fileMutex); //lock the mutex for planner
+			this->planner.flush(readyTasks); //add the batches that aren't full
+		}
+		catch (const exception& e) { //catch a runtime error that might be thrown
+			this->signal->sendSignalMessageBox("Error", e.what(), "critical"); //show a messagebox with error in GUI
+		}
+		for (const PlannedTask& task : readyTasks) //submit the tasks that are left
+			submitPlanned(task);
+		this->finishTask(); //the walk ended, release the job
+	});
+}
+
+
+/**
+ * @brief Method for submitting a planned task of wipe job.
+ * @param PlannedTask task
+ * @param int passes
+ * @param bool toRemove
+ */
+void FileHandler::submitWipeTask(const PlannedTask& task, int passes, bool toRemove) {
+	this->submitTask(task.device, [files = task.files, passes, toRemove]() { //we submit a task with wipe method and given parameters
+		for (File* file : files) //small files of a batch are wiped one after another
+			File::WipeFile(*file, passes, toRemove);
+	});
+}
+
+
+/**
+ * @brief Method for submitting a planned task of cipher job, a large file is split into regions that are processed in their own tasks.
+ * @param PlannedTask task
+ * @param string key
+ */
+void FileHandler::submitCipherTask(const PlannedTask& task, const string& key) {
+	File* file = task.files.front(); //represents the first file of task, large files are alone in their task
+	size_t fileSize = file->getLength(); //get the size of file
+	size_t numOfChunks = (fileSize + File::CipherChunkSize - 1) / File::CipherChunkSize; //represents the amount of CTR chunks in file
+	size_t numOfRegions = min(min(this->workersPerFile, this->poolSize), numOfChunks); //represents the amount of regions we split the file into, more regions than workers would only wait in the queues
+	size_t queueDepth = this->deviceLimiter.getProfile(task.device).streamDepth; //represents the requests each task keeps in flight, tasks of device share its queue depth
+	for (File* taskFile : task.files) //each task of device is one stream
+		taskFile->setQueueDepth(queueDepth);
+	if (task.files.size() == 1 && fileSize >= this->splitThreshold && numOfRegions > 1) { //if true we split the file into regions and process each region in its own task
+		size_t regionLength = ((numOfChunks + numOfRegions - 1) / numOfRegions) * File::CipherChunkSize; //set regionLength to be a multiple of CipherChunkSize
+		numOfRegions = (fileSize + regionLength - 1) / regionLength; //recalculate the amount of regions after rounding regionLength
+		file->setPendingRegions(numOfRegions); //set the amount of regions that need to finish before file is finished
+		for (size_t offset = 0; offset < fileSize; offset += regionLength) { //iterate over the regions of file
+			size_t length = min(regionLength, fileSize - offset); //represents the length of region
+			this->submitTask(task.device, [file = file, key, offset, length]() { File::CipherRegion(*file, key, offset, length); }); //we submit a task with cipher region method and given parameters
+		}
+	}
+	else { //else we process the whole file or batch of small files in one task
+		this->submitTask(task.device, [files = task.files, key]() { //we submit a task with cipher method and given parameters
+			for (File* file : files) //small files of a batch are processed one after another
+				File::CipherFile(*file, key);
+		});
+	}
+}
+
+
+/**
+ * @brief Method for adding a file to registry of job, the file is bound to the interned copy of its path and gets the id of path.
+ * @brief Returns false and deletes the file if its path is already in job. Callers that run with walkers hold fileMutex.
+ * @param File* file
+ * @param size_t root
+ */
+bool FileHandler::addFile(File* file, size_t root) {
+	bool isNew = false; //flag for indicating that path is new
+	size_t id = this->registry.intern(file->getPath(), &isNew); //register the path of file
+	if (!isNew) { //if true the file was chosen twice or is inside a chosen folder too
+		delete file;
+		return false;
+	}
+	file->setPath(this->registry.getPath(id)); //the file uses the interned path from now on
+	file->setId(id); //the id of file is its index in fileList
+	this->fileList.push_back(file); //add the file to the list of files by id
+	this->fileRoots.push_back(root); //save the folder root of file
+	return true;
+}
+
+
+/**
+ * @brief Method to initiate the file tasks and start wipe process on given files and folders.
  */
 void FileHandler::initWipe(int passes, bool toRemove) {
 	this->wipe = true; //set the wipe flag to true
-	this->numOfThreads = this->fileDictionarySize; //set the numOfThreads value to size of dictionary
-	this->threadsRunning = true; //set threadsRunning flag to true
+	this->toRemove = toRemove; //set the toRemove flag
+	this->startJob(); //start new job on the thread pool
 	try {
-		for (const auto& [fileName, file] : this->fileDictionary) { //iterate over the fileDictionary
-			thread fileThread(&File::WipeFile, *file, passes, toRemove); //we initiate a new thread with wipe method and given parameters
-			fileThread.detach(); //detach each thread so they run independently
-		}
+		this->planJob(); //plan the tasks of job
+		this->job.setTotalBytes(this->planner.getTotalSize() * (size_t)max(passes, 0)); //each pass writes every processed file once
+		for (const PlannedTask& task : this->planner.getTasks()) //iterate over the planned tasks, largest first
+			this->submitWipeTask(task, passes, toRemove);
+		this->walkFolders([this, passes, toRemove](const PlannedTask& task) { //files of folders are wiped as soon as their task is ready
+			this->deviceLimiter.addDevice(task.device, task.files.front()->getFullPath()); //query the profile of device if it's new
+			this->job.addTotalBytes(task.totalSize * (size_t)max(passes, 0)); //add the size of task to job
+			this->submitWipeTask(task, passes, toRemove);
+		});
 	}
 	catch (const exception& e) { //catch a runtime error that might be thrown
 		this->signal->sendSignalMessageBox("Error", e.what(), "critical"); //show a messagebox with error in GUI
 	}
+	this->finishTask(); //all tasks are submitted, release the job
 }
 
 
 /**
- * @brief Method to initiate the file threads and start cipher process on given files.
+ * @brief Method to initiate the file tasks and start cipher process on given files and folders.
  */
 void FileHandler::initCipher(const string& key, bool decrypt) {
 	this->decrypt = decrypt; //set decrypt flag 
-	this->numOfThreads = this->fileDictionarySize; //set the numOfThreads value to size of dictionary
-	this->threadsRunning = true; //set threadsRunning flag to true
+	this->startJob(); //start new job on the thread pool
 	try {
-		for (const auto& [fileName, file] : this->fileDictionary) { //iterate over the fileDictionary
-			thread fileThread(&File::CipherFile, *file, key, this->decrypt); //we initiate a new thread with cipher method and given parameters
-			fileThread.detach(); //detach each thread so they run independently
-		}
+		this->planJob(); //plan the tasks of job
+		this->job.setTotalBytes(this->planner.getTotalSize()); //cipher writes every processed file once
+		for (const PlannedTask& task : this->planner.getTasks()) //iterate over the planned tasks, largest first
+			this->submitCipherTask(task, key);
+		this->walkFolders([this, key](const PlannedTask& task) { //files of folders are processed as soon as their task is ready
+			this->deviceLimiter.addDevice(task.device, task.files.front()->getFullPath()); //query the profile of device if it's new
+			this->job.addTotalBytes(task.totalSize); //add the size of task to job
+			this->submitCipherTask(task, key);
+		});
 	}
 	catch (const exception& e) { //catch a runtime error that might be thrown
 		this->signal->sendSignalMessageBox("Error", e.what(), "critical"); //show a messagebox with error in GUI
 	}
+	this->finishTask(); //all tasks are submitted, release the job
 }
 
 
 /**
- * @brief Method of observer, responsible to notify the GUI when thread is finished it work.
- * @param Observable* observable
+ * @brief Method for draining the file events of job on GUI thread, returns the amount of events handled.
+ * @brief Workers push the events without locking and the changes of chosen files and folders are appended to updates,
+ * @brief so the GUI applies a whole drain to its listView at once. Paths of updates are valid while the handler lives.
+ * @param vector<FileUpdate> updates
+ * @param size_t maxEvents
  */
-void FileHandler::update(Observable* observable, bool state) {
-	this->threadMutex.lock(); //lock the mutex to prevent race conditions with threads
-	File* file = dynamic_cast<File*>(observable); //casting the Observable object to File object with dynamic_cast
-	if (file) { //if cast was successful we emit the signal
-		string fileName = File::ToString(file->getFullName()); //get file name from file object
-		fileName = (fileName.size() > 34) ? File::ToString(file->getName()).substr(0, 30) + "..." + File::ToString(file->getExtention()) : fileName; //we check fileName length and adjust its length accordingly
-		if (state) { //if operation was successful
-			if (!File::getIsCanceled()) { //if true we emit success message
-				if (this->wipe) //if wipe flag is true we emit a signal that wipe has finished
-					this->signal->sendSignalUpdateListView(File::ToString(file->getFullName()), fileName, " - Wiped Successfully"); //emit a signal to GUI to indicate that file has been wiped
-				else { //else we're encrypting/decrypting
-					if (!this->decrypt) //if true we emit a signal that encryption has finished
-						this->signal->sendSignalUpdateListView(File::ToString(file->getFullName()), fileName, " - Encrypted Successfully"); //emit a signal to GUI to indicate that file has been encrypted
-					else //else we emit a signal that decryption has finished
-						this->signal->sendSignalUpdateListView(File::ToString(file->getFullName()), fileName, " - Decrypted Successfully"); //emit a signal to GUI to indicate that file has been decrypted
-				}
+size_t FileHandler::processEvents(vector<FileUpdate>& updates, size_t maxEvents) {
+	lock_guard<mutex> lock(this->fileMutex); //lock the mutex for files, walkers may add files while we drain
+	FileEvent event; //represents the current event
+	size_t handled = 0; //represents the amount of handled events
+	while (handled < maxEvents && this->job.getEvents().tryPop(event)) { //pop the events that workers pushed
+		handled++;
+		if (event.fileId >= this->fileList.size()) //if true the event doesn't belong to our files
+			continue;
+		File* file = this->fileList[event.fileId]; //get the file of event
+		this->reportFile(file, event.phase, updates); //update the GUI for file
+		for (File* alias : this->planner.getAliases(file)) { //duplicates of same inode weren't processed, they get the result of this file
+			FilePhase aliasPhase = event.phase; //represents the final phase of alias
+			try {
+				if (this->wipe && this->toRemove && event.phase == FilePhase::Finished) //if true we also remove the other name of wiped file
+					File::removeFile(*alias);
+			}
+			catch (const exception& e) { //catch exception if we failed removing the alias
+				alias->setFailed(FileError::RemoveFailed); //save the error of alias
+				aliasPhase = FilePhase::Failed; //report the alias as failed
 			}
-			else //else we emit cancel message
-				this->signal->sendSignalUpdateListView(File::ToString(file->getFullName()), fileName, " - Canceled"); //emit a signal to GUI to indicate that wipe canceled on file
+			if (event.phase == FilePhase::Failed) //if true the alias gets the error of processed file
+				alias->setFailed(event.error);
+			alias->setPhase(aliasPhase); //set the final phase of alias
+			this->reportFile(alias, aliasPhase, updates); //update the GUI for alias
 		}
-		else //else operation failed
-			this->signal->sendSignalUpdateListView(File::ToString(file->getFullName()), fileName, " - Failed"); //emit a signal to GUI to indicate that we failed perofrming operation
 	}
-	else //else cast failed 
-		this->signal->sendSignalMessageBox("Error", "Thread: Failed to update GUI", "critical"); //we emit signal to show messagebox with error
-	this->threadMutex.unlock(); //unlock mutex
+	for (FolderRoot& root : this->folderRoots) { //update the GUI once for each folder that changed in this drain
+		if (!root.isDirty)
+			continue;
+		FileUpdate update; //represents the update of folder item with its counts
+		update.path = root.path;
+		update.isFolder = true;
+		update.finished = root.finished;
+		update.failed = root.failed;
+		update.canceled = root.canceled;
+		updates.push_back(update);
+		root.isDirty = false;
+	}
+	return handled;
+}
+
+
+/**
+ * @brief Method for adding the final phase of file to updates of GUI listView, files of folders are counted into their folder item.
+ * @param File* file
+ * @param FilePhase phase
+ * @param vector<FileUpdate> updates
+ */
+void FileHandler::reportFile(File* file, FilePhase phase, vector<FileUpdate>& updates) {
+	size_t rootIndex = this->fileRoots[file->getId()]; //represents the folder root of file
+	if (rootIndex != NoRoot) { //if true the file was found in a folder, we count it and the folder item is updated after the drain
+		FolderRoot& root = this->folderRoots[rootIndex];
+		if (phase == FilePhase::Finished)
+			root.finished++;
+		else if (phase == FilePhase::Canceled)
+			root.canceled++;
+		else
+			root.failed++;
+		root.isDirty = true;
+		return;
+	}
+	FileUpdate update; //represents the update of file item, items in GUI are keyed by full path
+	update.path = file->getPath();
+	update.phase = phase;
+	updates.push_back(update);
 }
 
 
 /**
- * @brief Method to notify threads that user wants to stop process.
- * @param Observable* observable
+ * @brief Method to notify threads that user wants to stop process, workers see the token of job before their next chunk.
  */
 void FileHandler::cancelProcess() {
-	if (!File::getIsCanceled())
-		File::setIsCanceled(true); //set the isCanceled flag to true
+	this->job.cancel(); //cancel the job and wake workers that wait for bandwidth
+}
+
+
+/**
+ * @brief Method for canceling a single file of job, the other files continue. Returns false if file is not in job.
+ * @param string filePath
+ */
+bool FileHandler::cancelFile(const string& filePath) {
+	lock_guard<mutex> lock(this->fileMutex); //lock the mutex for registry, walkers may add files
+	size_t id = this->registry.find(filePath); //find the file by its full path
+	if (id == FileRegistry::NotFound) //if true the file is not in job
+		return false;
+	this->fileList[id]->cancel(); //cancel the file, its worker stops before next chunk
+	return true;
 }
\ No newline at end of file
@@ -8,35 +8,117 @@
 #include <unordered_map>
 #include <thread>
 #include <mutex>
+#include <future>
+#include <functional>
 #include "File.h"
+#include "ThreadPool.h"
+#include "JobPlanner.h"
+#include "DeviceLimiter.h"
+#include "ThreadPriority.h"
+#include "JobToken.h"
+#include "DirectoryWalker.h"
+#include "FileRegistry.h"
+#include "MetadataLoader.h"
 #include "SignalProxy.h"
 
 using namespace std;
 
+/**
+ * @brief Struct that represents the settings of jobs that are chosen in GUI, applied to each handler before its job starts.
+ */
+struct JobSettings {
+	bool backgroundMode = false; //flag for indicating if workers run with idle I/O class and lowered CPU priority
+	size_t bandwidthLimit = 0; //represents the bandwidth cap of job in MB/s, zero for unlimited
+	size_t poolSize = max(thread::hardware_concurrency(), 1u); //represents the amount of worker threads in pool
+	size_t workersPerFile = max(thread::hardware_concurrency(), 1u); //represents the maximum amount of regions of each large file
+	size_t splitThreshold = 64 * 1024 * 1024; //represents the minimal file size for splitting a file between threads
+};
+
+
 /**
  * Class that represent shredding multiple files.
  */
-class FileHandler : public Observer {
+class FileHandler {
 private:
-	unordered_map<wstring, File*> fileDictionary; //file dictionary for wipe
-	size_t fileDictionarySize; //represents the size of dictionary
-	int numOfThreads = 0; //represents the current amount of running threads
-	bool threadsRunning = false; //flag for indicating if threads are running
+	FileRegistry registry; //registry of files of job by their full path, the id of each path is the id of its file
+	vector<File*> fileList; //represents the files of job by their id
+	vector<size_t> fileRoots; //represents the index of folder root of each file in fileList, NoRoot for files that were chosen directly
+	size_t numOfChosenFiles = 0; //represents the amount of files that were chosen directly, they're the first files of fileList
 	bool wipe = false; //flag for indicating if we wipe
 	bool decrypt = false; //flag for indicating if we decrypt
-	recursive_mutex threadMutex; //mutex for thread-safe operations
+	bool toRemove = false; //flag for indicating if we remove files after wipe
+	size_t splitThreshold = 64 * 1024 * 1024; //represents the minimal file size for splitting a file between threads
+	size_t workersPerFile = max(thread::hardware_concurrency(), 1u); //represents the maximum amount of regions of each large file, never more than the workers of pool
+	size_t poolSize = max(thread::hardware_concurrency(), 1u); //represents the amount of worker threads in pool, tasks never start threads of their own so it bounds the threads that process files
+	unique_ptr<ThreadPool> threadPool; //pool of worker threads that run the tasks, each task is a whole file, a batch of small files or a region of large file
+	JobPlanner planner; //planner that orders, deduplicates and batches the files of job
+	DeviceLimiter deviceLimiter; //limiter of concurrent tasks on each storage device
+	bool backgroundMode = false; //flag for indicating if workers run with lowered I/O and CPU priority
+	ThreadPriority::IOClass backgroundIOClass = ThreadPriority::Idle; //represents the I/O class of workers in background mode
+	int backgroundIOLevel = 7; //represents the I/O level of workers in background mode, used by best effort class
+	int backgroundNice = 10; //represents the nice value of workers in background mode
+	size_t bandwidthLimit = 0; //represents the bandwidth cap of job in MB/s, zero for unlimited
+	JobToken job; //token of job, holds its cancellation and failure flags and the bandwidth throttle shared by its files
+	atomic<size_t> pendingTasks = 0; //represents the amount of tasks of current job that didn't finish yet
+	promise<void> jobPromise; //promise that is fulfilled when all tasks of current job finished
+	shared_future<void> jobFuture; //future of current job
 	SignalProxy* signal; //signal object for communicating with GUI
 
+	/**
+	 * @brief Struct that represents a chosen folder, files found under it are reported to GUI as one item.
+	 */
+	struct FolderRoot {
+		string path; //represents the UTF-8 path of folder
+		size_t finished = 0; //represents the amount of files of folder that finished successfully
+		size_t failed = 0; //represents the amount of files of folder that failed
+		size_t canceled = 0; //represents the amount of files of folder that were canceled
+		bool isDirty = false; //flag for indicating that counts changed since last update of GUI
+	};
+
+	vector<FolderRoot> folderRoots; //represents the chosen folders that are walked while the job runs
+	DirectoryWalker walker; //walker that finds the files of chosen folders
+	thread walkerThread; //thread that runs the walk of current job
+	mutex fileMutex; //mutex for fileList, fileRoots and planner while walkers stream new files into the job
+	void startJob();
+	void submitTask(unsigned long long device, function<void()> task);
+	void finishTask();
+	void planJob();
+	bool addFile(File* file, size_t root);
+	void walkFolders(function<void(const PlannedTask&)> submitPlanned);
+	void submitWipeTask(const PlannedTask& task, int passes, bool toRemove);
+	void submitCipherTask(const PlannedTask& task, const string& key);
+	void reportFile(File* file, FilePhase phase, vector<FileUpdate>& updates);
+
 public:
-	FileHandler(const vector<string> filePathList, SignalProxy* signal);
+	static constexpr size_t MaxEventsPerDrain = 4096; //maximal amount of file events handled in one drain so GUI stays responsive
+	static constexpr size_t StreamEventCapacity = 64 * 1024; //minimal capacity of event queue when folders are walked, their file count isn't known in advance
+	static constexpr size_t NoRoot = SIZE_MAX; //represents a file that wasn't found under a chosen folder
+	FileHandler(const vector<string> filePathList, const vector<FileMetadata>& metadataList, SignalProxy* signal, const vector<string> folderPathList = {});
 	virtual ~FileHandler();
 	void initWipe(int passes=1, bool toRemove=false);
 	void initCipher(const string& key, bool decrypt=false);
-	void update(Observable* observable, bool state=true) override;
+	size_t processEvents(vector<FileUpdate>& updates, size_t maxEvents=MaxEventsPerDrain);
 	void cancelProcess();
-	bool areThreadsRunning() { return this->threadsRunning; }
-	int getNumOfThreads() { return this->numOfThreads; }
-	void setThreadsRunning(bool state) { this->threadsRunning = state; }
-	void setNumOfThreads(int number) { this->numOfThreads = number; }
+	bool cancelFile(const string& filePath);
+	static string FolderName(const string& folderPath);
+	JobToken& getJob() { return this->job; }
+	const vector<File*>& getFiles() { return this->fileList; }
+	FileRegistry& getRegistry() { return this->registry; }
+	bool isJobRunning() { return this->jobFuture.valid() && this->jobFuture.wait_for(chrono::seconds(0)) != future_status::ready; }
+	shared_future<void> getJobFuture() { return this->jobFuture; }
+	JobPlanner& getPlanner() { return this->planner; }
+	DeviceLimiter& getDeviceLimiter() { return this->deviceLimiter; }
+	DirectoryWalker& getWalker() { return this->walker; }
+	size_t getPoolSize() { return this->poolSize; }
+	void setPoolSize(size_t number) { this->poolSize = max(number, (size_t)1); }
+	size_t getSplitThreshold() { return this->splitThreshold; }
+	void setSplitThreshold(size_t size) { this->splitThreshold = size; }
+	size_t getWorkersPerFile() { return this->workersPerFile; }
+	void setWorkersPerFile(size_t number) { this->workersPerFile = max(number, (size_t)1); }
+	void setBackgroundMode(bool state, ThreadPriority::IOClass ioClass=ThreadPriority::Idle, int ioLevel=7, int niceValue=10);
+	bool getBackgroundMode() { return this->backgroundMode; }
+	size_t getBandwidthLimit() { return this->bandwidthLimit; }
+	void setBandwidthLimit(size_t megabytesPerSecond) { this->bandwidthLimit = megabytesPerSecond; }
+	void applySettings(const JobSettings& settings);
 };
 #endif
\ No newline at end of file
@@ -0,0 +1,219 @@
+#include "FileListModel.h"
+#include "FileHandler.h"
+#include "Utf8.h"
+
+
+/**
+ * @brief Method for getting the amount of rows in listView.
+ * @param QModelIndex parent
+ */
+int FileListModel::rowCount(const QModelIndex& parent) const {
+    return parent.isValid() ? 0 : (int)this->items.size(); //list has no children
+}
+
+
+/**
+ * @brief Method for getting the text of row, the name of item followed by its status.
+ * @param QModelIndex index
+ * @param int role
+ */
+QVariant FileListModel::data(const QModelIndex& index, int role) const {
+    if (!index.isValid() || index.row() >= (int)this->items.size() || role != Qt::DisplayRole) //if true we have no data for this request
+        return QVariant();
+    const Item& item = this->items[index.row()]; //represents the item of row
+    string_view path = this->registry.getPath((size_t)index.row()); //represents the full path of item
+    QString name = QString::fromStdString(item.isFolder ? FileHandler::FolderName(string(path)) : FileListModel::DisplayName(path)); //represents the displayed name of item
+    return name + this->statusText(item);
+}
+
+
+/**
+ * @brief Function for getting the displayed name of file, long names are cut to 30 bytes of whole characters followed by "..." and their extension.
+ * @param string_view filePath
+ */
+string FileListModel::DisplayName(string_view filePath) {
+    size_t separator = filePath.find_last_of("/\\"); //represents the position of last separator
+    string_view fullName = (separator == string_view::npos) ? filePath : filePath.substr(separator + 1); //represents the name of file with its extension
+    if (fullName.size() <= MaxNameLength) //if true the name fits
+        return string(fullName);
+    size_t dot = fullName.find_last_of('.'); //represents the position of last dot
+    string_view extension = (dot == string_view::npos || dot == 0) ? string_view() : fullName.substr(dot); //represents the extension of file
+    string_view name = fullName.substr(0, fullName.size() - extension.size()); //represents the name of file without its extension
+    return string(Utf8::Truncate(name, 30)) + "..." + string(extension);
+}
+
+
+/**
+ * @brief Method for getting the status text of item.
+ * @param Item item
+ */
+QString FileListModel::statusText(const Item& item) const {
+    QString operation = (item.operation == ItemOperation::Wipe) ? "Wiped" : (item.operation == ItemOperation::Encrypt) ? "Encrypted" : "Decrypted"; //represents the operation of item
+    switch (item.status) {
+    case ItemStatus::Queued: //item waits for next job
+        return QString();
+    case ItemStatus::Processing:
+        return " - Processing..";
+    case ItemStatus::Succeeded:
+        return " - " + operation + " Successfully";
+    case ItemStatus::Finished:
+        return " - Finished";
+    case ItemStatus::Canceled:
+        return " - Canceled";
+    case ItemStatus::Failed:
+        return " - Failed";
+    case ItemStatus::Counted: { //folder shows the counts of its files
+        QString text = QString(" - %1 Files ").arg(item.finished) + operation; //represents the counts of folder
+        if (item.failed > 0) //if true we add the failed files
+            text += QString(", %1 Failed").arg(item.failed);
+        if (item.canceled > 0) //if true we add the canceled files
+            text += QString(", %1 Canceled").arg(item.canceled);
+        return text;
+    }
+    }
+    return QString();
+}
+
+
+/**
+ * @brief Method for notifying the view of changed rows, each run of adjacent rows is sent as one range.
+ * @param vector<size_t> rows
+ */
+void FileListModel::notifyRows(const vector<size_t>& rows) {
+    size_t i = 0; //represents the first row of current run
+    while (i < rows.size()) { //iterate over the runs of rows
+        size_t end = i + 1; //represents the end of current run
+        while (end < rows.size() && rows[end] == rows[end - 1] + 1) //extend the run while rows are adjacent
+            end++;
+        emit dataChanged(this->index((int)rows[i]), this->index((int)rows[end - 1]), { Qt::DisplayRole }); //notify the view of run
+        i = end;
+    }
+}
+
+
+/**
+ * @brief Method for adding items for next job, new paths are inserted as one batch of rows and items of earlier jobs are queued again.
+ * @param vector<string> paths
+ * @param bool isFolder
+ */
+void FileListModel::addItems(const vector<string>& paths, bool isFolder) {
+    size_t first = this->items.size(); //represents the row of first new item
+    vector<size_t> requeued; //represents the rows of earlier items that are queued again
+    for (const string& path : paths) { //register each path, rows can't see new ids until items grow
+        size_t row = this->registry.intern(path); //represents the row of path
+        if (row >= first) //if true the path is new in this batch
+            continue;
+        Item& item = this->items[row]; //represents the earlier item of path
+        if (item.isQueued) //if true the item is already queued
+            continue;
+        item = Item(); //queue the item again with a clear status
+        item.isFolder = isFolder;
+        this->numOfQueued++;
+        requeued.push_back(row);
+    }
+    size_t last = this->registry.size(); //represents the end of new rows
+    if (last > first) { //if true we insert the new rows at once
+        this->beginInsertRows(QModelIndex(), (int)first, (int)last - 1);
+        Item item; //represents a new queued item
+        item.isFolder = isFolder;
+        this->items.resize(last, item); //add the new items
+        this->numOfQueued += last - first;
+        this->endInsertRows();
+    }
+    sort(requeued.begin(), requeued.end()); //sort the rows so adjacent rows are sent together
+    this->notifyRows(requeued);
+}
+
+
+/**
+ * @brief Method for checking if path is queued for next or running job.
+ * @param string_view path
+ */
+bool FileListModel::isQueued(string_view path) const {
+    size_t row = this->registry.find(path); //represents the row of path
+    return row != FileRegistry::NotFound && this->items[row].isQueued;
+}
+
+
+/**
+ * @brief Method for marking the queued items as processing when their job starts.
+ * @param ItemOperation operation
+ */
+void FileListModel::startJob(ItemOperation operation) {
+    vector<size_t> rows; //represents the rows of queued items
+    for (size_t row = 0; row < this->items.size(); row++) { //iterate over the items
+        Item& item = this->items[row];
+        if (!item.isQueued) //if true item belongs to earlier job
+            continue;
+        item.status = ItemStatus::Processing; //item is part of running job
+        item.operation = operation;
+        item.finished = item.failed = item.canceled = 0;
+        rows.push_back(row);
+    }
+    this->notifyRows(rows);
+}
+
+
+/**
+ * @brief Method for releasing the items of finished job, their status stays until they're archived or queued again.
+ */
+void FileListModel::finishJob() {
+    for (Item& item : this->items) //iterate over the items
+        item.isQueued = false; //item belongs to an earlier job now, text doesn't change
+    this->numOfQueued = 0;
+}
+
+
+/**
+ * @brief Method for marking the files that succeeded in last job as finished before new items are added.
+ */
+void FileListModel::archiveResults() {
+    vector<size_t> rows; //represents the rows of archived items
+    for (size_t row = 0; row < this->items.size(); row++) { //iterate over the items
+        if (this->items[row].status == ItemStatus::Succeeded && !this->items[row].isQueued) { //if true the file succeeded in an earlier job
+            this->items[row].status = ItemStatus::Finished;
+            rows.push_back(row);
+        }
+    }
+    this->notifyRows(rows);
+}
+
+
+/**
+ * @brief Method for applying the updates of a drain, items are changed first and the view is notified once
+ * @brief with the range of rows that changed, so a burst of finished files costs one repaint.
+ * @param vector<FileUpdate> updates
+ */
+void FileListModel::applyUpdates(const vector<FileUpdate>& updates) {
+    size_t firstRow = SIZE_MAX, lastRow = 0; //represents the range of changed rows
+    for (const FileUpdate& update : updates) { //apply each update, a later update of same item replaces earlier one
+        size_t row = this->registry.find(update.path); //represents the row of item
+        if (row == FileRegistry::NotFound || this->items[row].isFolder != update.isFolder) //if true the update has no item of its own
+            continue;
+        Item& item = this->items[row];
+        if (update.isFolder) { //if true folder shows the counts of its files
+            item.status = ItemStatus::Counted;
+            item.finished = update.finished;
+            item.failed = update.failed;
+            item.canceled = update.canceled;
+        }
+        else //else we set the status of file from its final phase
+            item.status = (update.phase == FilePhase::Finished) ? ItemStatus::Succeeded : (update.phase == FilePhase::Canceled) ? ItemStatus::Canceled : ItemStatus::Failed;
+        firstRow = min(firstRow, row);
+        lastRow = max(lastRow, row);
+    }
+    if (firstRow <= lastRow) //if true at least one row changed, view repaints only the visible part of range
+        emit dataChanged(this->index((int)firstRow), this->index((int)lastRow), { Qt::DisplayRole });
+}
+
+
+/**
+ * @brief Method for removing all items.
+ */
+void FileListModel::clear() {
+    this->beginResetModel();
+    this->registry.clear(); //remove the paths
+    this->items.clear(); //remove the items
+    this->numOfQueued = 0;
+    this->endResetModel();
+}
\ No newline at end of file
@@ -0,0 +1,82 @@
+#ifndef _FileListModel_H
+#define _FileListModel_H
+#define _CRT_SECURE_NO_WARNINGS
+#include <QAbstractListModel>
+#include <iostream>
+#include <string.h>
+#include <string_view>
+#include <vector>
+#include "FileRegistry.h"
+#include "FileEvent.h"
+
+using namespace std;
+
+/**
+ * @brief Enum that represents the status of item in file listView.
+ */
+enum class ItemStatus : unsigned char {
+    Queued, //item was chosen and waits for next job
+    Processing, //item is part of running job
+    Succeeded, //file finished successfully in last job
+    Finished, //file finished successfully in an earlier job
+    Canceled, //file was canceled
+    Failed, //file failed
+    Counted //folder shows the counts of its files
+};
+
+/**
+ * @brief Enum that represents the operation of job that processed the item.
+ */
+enum class ItemOperation : unsigned char {
+    Wipe, //files are wiped
+    Encrypt, //files are encrypted
+    Decrypt //files are decrypted
+};
+
+/**
+ * @brief Class that represents the chosen files and folders in file listView, each row is an item keyed by its full path.
+ * @brief Paths are interned in a file registry and the id of each path is its row, so looking up the row of a finished file costs
+ * @brief a hash probe and rows hold only a small status record. Item text is built from the status when a row is painted,
+ * @brief so only visible rows are formatted and each change notifies the view of the rows it touched.
+ */
+class FileListModel : public QAbstractListModel {
+    Q_OBJECT
+
+private:
+    /**
+     * @brief Struct that represents the status of item.
+     */
+    struct Item {
+        ItemStatus status = ItemStatus::Queued; //represents the status of item
+        ItemOperation operation = ItemOperation::Wipe; //represents the operation of job that processed the item
+        bool isFolder = false; //flag for indicating that item is a folder
+        bool isQueued = true; //flag for indicating that item belongs to next or running job
+        size_t finished = 0; //represents the amount of files of folder that finished successfully
+        size_t failed = 0; //represents the amount of files of folder that failed
+        size_t canceled = 0; //represents the amount of files of folder that were canceled
+    };
+
+    FileRegistry registry; //registry of items by their full path, the id of each path is its row
+    vector<Item> items; //represents the items by their row
+    size_t numOfQueued = 0; //represents the amount of items that belong to next or running job
+    void notifyRows(const vector<size_t>& rows);
+    QString statusText(const Item& item) const;
+
+public:
+    static constexpr size_t MaxNameLength = 34; //maximal length of displayed name, longer names are cut around their extension
+    FileListModel(QObject* parent = nullptr) : QAbstractListModel(parent) {}
+    int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
+    static string DisplayName(string_view filePath);
+    void addItems(const vector<string>& paths, bool isFolder = false);
+    bool isQueued(string_view path) const;
+    void startJob(ItemOperation operation);
+    void finishJob();
+    void archiveResults();
+    void applyUpdates(const vector<FileUpdate>& updates);
+    void clear();
+    string_view getPath(int row) const { return this->registry.getPath((size_t)row); }
+    bool isFolder(int row) const { return this->items[row].isFolder; }
+    bool hasQueuedItems() const { return this->numOfQueued > 0; }
+};
+#endif
\ No newline at end of file
@@ -0,0 +1,121 @@
+#include "FileRegistry.h"
+
+
+/**
+ * @brief Function for hashing a path with 64 bit FNV-1a folded to 32 bits.
+ * @param string_view path
+ */
+uint32_t FileRegistry::Hash(string_view path) {
+	uint64_t hash = 14695981039346656037ULL; //represents the FNV offset basis
+	for (unsigned char c : path) { //mix each byte of path
+		hash ^= c;
+		hash *= 1099511628211ULL; //multiply by FNV prime
+	}
+	return (uint32_t)(hash ^ (hash >> 32)); //fold the high bits into the low bits
+}
+
+
+/**
+ * @brief Method for copying a path into the arena with a null terminator, returns the copy.
+ * @param string_view path
+ */
+const char* FileRegistry::store(string_view path) {
+	size_t size = path.size() + 1; //represents the size of copy with null terminator
+	if (this->chunkUsed + size > ChunkSize) { //if true the last chunk is full, we start a new one
+		this->chunks.push_back(make_unique<char[]>(max(size, ChunkSize))); //a path longer than a chunk gets a chunk of its own size
+		this->chunkUsed = 0;
+	}
+	char* copy = this->chunks.back().get() + this->chunkUsed; //represents the copy of path
+	memcpy(copy, path.data(), path.size()); //copy the path
+	copy[path.size()] = '\0';
+	this->chunkUsed += size; //advance in chunk
+	return copy;
+}
+
+
+/**
+ * @brief Method for rebuilding the hash table with given amount of slots, must be a power of two.
+ * @param size_t numOfSlots
+ */
+void FileRegistry::rehash(size_t numOfSlots) {
+	this->table.assign(numOfSlots, EmptySlot); //clear the table with new size
+	size_t mask = numOfSlots - 1; //represents the mask for slot index
+	for (uint32_t id = 0; id < (uint32_t)this->entries.size(); id++) { //insert each id again by its saved hash
+		size_t slot = this->entries[id].hash & mask; //represents the first slot of id
+		while (this->table[slot] != EmptySlot) //find the next empty slot
+			slot = (slot + 1) & mask;
+		this->table[slot] = id;
+	}
+}
+
+
+/**
+ * @brief Method for registering a path, returns the id of path. If path was registered before we return its id and isNew is false.
+ * @param string_view path
+ * @param bool* isNew
+ */
+size_t FileRegistry::intern(string_view path, bool* isNew) {
+	if ((this->entries.size() + 1) * 4 > this->table.size() * 3) //if true table would be more than three quarters full, we double it
+		this->rehash(max(this->table.size() * 2, (size_t)64));
+	uint32_t hash = FileRegistry::Hash(path); //represents the hash of path
+	size_t mask = this->table.size() - 1; //represents the mask for slot index
+	size_t slot = hash & mask; //represents the current slot
+	while (this->table[slot] != EmptySlot) { //probe until we find the path or an empty slot
+		const Entry& entry = this->entries[this->table[slot]]; //represents the entry of slot
+		if (entry.hash == hash && string_view(entry.path, entry.length) == path) { //if true the path is registered
+			if (isNew)
+				*isNew = false;
+			return this->table[slot];
+		}
+		slot = (slot + 1) & mask;
+	}
+	uint32_t id = (uint32_t)this->entries.size(); //represents the id of new path
+	this->entries.push_back({ this->store(path), (uint32_t)path.size(), hash }); //intern the path
+	this->table[slot] = id; //add the id to table
+	if (isNew)
+		*isNew = true;
+	return id;
+}
+
+
+/**
+ * @brief Method for finding the id of registered path, returns NotFound if path isn't registered.
+ * @param string_view path
+ */
+size_t FileRegistry::find(string_view path) const {
+	if (this->table.empty()) //if true nothing is registered
+		return NotFound;
+	uint32_t hash = FileRegistry::Hash(path); //represents the hash of path
+	size_t mask = this->table.size() - 1; //represents the mask for slot index
+	for (size_t slot = hash & mask; this->table[slot] != EmptySlot; slot = (slot + 1) & mask) { //probe until an empty slot
+		const Entry& entry = this->entries[this->table[slot]]; //represents the entry of slot
+		if (entry.hash == hash && string_view(entry.path, entry.length) == path) //if true we found the path
+			return this->table[slot];
+	}
+	return NotFound;
+}
+
+
+/**
+ * @brief Method for reserving room for given amount of paths, so registering them doesn't grow the table.
+ * @param size_t count
+ */
+void FileRegistry::reserve(size_t count) {
+	this->entries.reserve(count); //reserve the entries
+	size_t numOfSlots = 64; //represents the amount of slots that keeps the table at most three quarters full
+	while (count * 4 > numOfSlots * 3)
+		numOfSlots *= 2;
+	if (numOfSlots > this->table.size()) //if true we grow the table
+		this->rehash(numOfSlots);
+}
+
+
+/**
+ * @brief Method for removing all paths, views of interned paths are invalid after this call.
+ */
+void FileRegistry::clear() {
+	this->chunks.clear(); //free the arena
+	this->chunkUsed = ChunkSize; //no chunk is open
+	this->entries.clear(); //clear the entries
+	this->table.clear(); //clear the table
+}
\ No newline at end of file
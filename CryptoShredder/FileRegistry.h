@@ -0,0 +1,49 @@
+#ifndef _FileRegistry_H
+#define _FileRegistry_H
+#define _CRT_SECURE_NO_WARNINGS
+#include <iostream>
+#include <string.h>
+#include <string_view>
+#include <vector>
+#include <memory>
+#include <cstdint>
+
+using namespace std;
+
+/**
+ * @brief Class that registers the files of a job by their full path and gives each path a compact integer id.
+ * @brief Paths are interned as UTF-8 strings in an arena of large chunks that never move, so a view of an interned path stays valid
+ * @brief while the registry lives. Lookups use an open-addressing hash table of ids with linear probing,
+ * @brief so each path costs its bytes, an entry of 16 bytes and a few bytes of table instead of a node and a string per file.
+ */
+class FileRegistry {
+private:
+	/**
+	 * @brief Struct that represents an interned path.
+	 */
+	struct Entry {
+		const char* path = NULL; //represents the null terminated path in arena
+		uint32_t length = 0; //represents the length of path without null terminator
+		uint32_t hash = 0; //represents the hash of path, saved so the table grows without hashing again
+	};
+
+	static constexpr uint32_t EmptySlot = UINT32_MAX; //represents an empty slot of table
+	static constexpr size_t ChunkSize = 256 * 1024; //size of each arena chunk, longer paths get a chunk of their own
+	vector<unique_ptr<char[]>> chunks; //represents the chunks of arena
+	size_t chunkUsed = ChunkSize; //represents the amount of bytes used in last chunk, full until first chunk is created
+	vector<Entry> entries; //represents the interned paths by their id
+	vector<uint32_t> table; //represents the hash table of ids, its size is a power of two
+	static uint32_t Hash(string_view path);
+	const char* store(string_view path);
+	void rehash(size_t numOfSlots);
+
+public:
+	static constexpr size_t NotFound = SIZE_MAX; //represents a path that isn't registered
+	size_t intern(string_view path, bool* isNew=NULL);
+	size_t find(string_view path) const;
+	void reserve(size_t count);
+	void clear();
+	string_view getPath(size_t id) const { return { this->entries[id].path, this->entries[id].length }; }
+	size_t size() const { return this->entries.size(); }
+};
+#endif
\ No newline at end of file
@@ -7,18 +7,25 @@ bool FileViewer::isInstance = false; //initialize the static instance flag
 /**
  * @brief Constructor of class.
  * @param QWidget* parent
- * @param QString filePath
+ * @param string filePath
  * @param QString fileName
  */
-FileViewer::FileViewer(QWidget* parent, const QString& filePath, const QString& fileName) : QDialog(parent) {
+FileViewer::FileViewer(QWidget* parent, const string& filePath, const QString& fileName) : QDialog(parent) {
     ui.setupUi(this); //set ui elements
-    this->file.setFileName(filePath); //set file name for QFile object
     ui.FileNameLabel->setText(QString(QChar(0x200E)) + fileName); //set the file name in FileViewer
     //set the tooltip for the window
-    this->setWhatsThis("This window serves as a viewer for the selected file in one of three formats: HEX, BINARY, or UTF-8. You can choose the format using the dropdown menu. The viewer allows you to inspect the file's contents in the selected format.");
+    this->setWhatsThis("This window serves as a viewer for the selected file in one of three formats: HEX, BINARY, or UTF-8. You can choose the format using the dropdown menu. The viewer allows you to scroll through the file's contents in the selected format or jump to any offset, only the rows on screen are read from the file. You can also search the whole file for HEX bytes or text in background and click a hit to show its row. ANALYSIS format shows the entropy of the whole file and its byte histogram, wiped and encrypted files should have no low-entropy blocks.");
     ui.FileTextEdit->viewport()->setCursor(Qt::ArrowCursor); //set cursor for FileTextEdit
+    ui.FileTextEdit->installEventFilter(this); //handle the scrolling keys of FileTextEdit
+    ui.FileTextEdit->viewport()->installEventFilter(this); //handle the mouse wheel of FileTextEdit, wheel events are sent to its viewport
+    ui.AnalysisLabel->installEventFilter(this); //handle the clicks on entropy chart
+    ui.AnalysisLabel->hide(); //analysis panel is shown only in analysis mode
     this->setAttribute(Qt::WA_DeleteOnClose); //ensure that object gets deleted when window closes
     this->setModal(true); //set the dialog model to block interactions with main GUI 
+    this->searchTimer = new QTimer(this); //initialize the timer that collects the hits of search
+    this->searchTimer->setInterval(SearchInterval); //collect the hits at a fixed rate
+    this->analysisTimer = new QTimer(this); //initialize the timer that collects the windows of analysis
+    this->analysisTimer->setInterval(AnalysisInterval); //collect the windows at a fixed rate
     
     //this will make the text inside textEdit from left to right regardless of language 
     //QTextDocument* doc = ui.FileTextEdit->document();
@@ -27,8 +34,14 @@ FileViewer::FileViewer(QWidget* parent, const QString& filePath, const QString&
     //doc->setDefaultTextOption(textOption);
     //ui.FileTextEdit->setDocument(doc);
     
-    connect(ui.FileTextEdit->verticalScrollBar(), &QScrollBar::valueChanged, this, &FileViewer::loadChunk); //connect signal for adding text when scrolling
+    connect(ui.FileScrollBar, &QScrollBar::valueChanged, this, &FileViewer::scrollMoved); //connect signal for showing the rows of scroll position
     connect(ui.FormatComboBox, QOverload<int>::of(&QComboBox::currentIndexChanged), this, &FileViewer::updateFileContent); //connect signal for combo box index changed event
+    connect(ui.OffsetLineEdit, &QLineEdit::returnPressed, this, &FileViewer::goToOffset); //connect signal for jumping to offset
+    connect(ui.SearchButton, &QPushButton::clicked, this, &FileViewer::searchClicked); //connect signal for starting and stopping search
+    connect(ui.SearchLineEdit, &QLineEdit::returnPressed, this, &FileViewer::startSearch); //connect signal for starting search
+    connect(ui.SearchResultsList, &QListWidget::itemClicked, this, &FileViewer::resultClicked); //connect signal for showing the row of hit
+    connect(this->searchTimer, &QTimer::timeout, this, &FileViewer::updateSearch); //connect signal for collecting the hits of search
+    connect(this->analysisTimer, &QTimer::timeout, this, &FileViewer::updateAnalysis); //connect signal for collecting the windows of analysis
 
     if (this->openFile(filePath)) { //if true we show the window
         this->show(); //show window
@@ -44,6 +57,10 @@ FileViewer::FileViewer(QWidget* parent, const QString& filePath, const QString&
  * @brief Destructor of class.
  */
 FileViewer::~FileViewer() {
+    this->search.reset(); //stop the search and wait for its worker
+    delete this->searchTimer; //delete the search timer
+    this->analysis.reset(); //stop the analysis and wait for its tasks
+    delete this->analysisTimer; //delete the analysis timer
     if (isInstance)
         isInstance = false; //ensure that we return the instance flag back to false when object deleted
 }
@@ -52,11 +69,11 @@ FileViewer::~FileViewer() {
 /**
  * @brief Method for getting instance for singleton class.
  * @param QWidget* parent
- * @param QString filePath
+ * @param string filePath
  * @param QString fileName
  * @return FileViewer* viewer
  */
-FileViewer* FileViewer::getInstance(QWidget* parent, const QString& filePath, const QString& fileName) {
+FileViewer* FileViewer::getInstance(QWidget* parent, const string& filePath, const QString& fileName) {
     if (!isInstance) { //if true we can give the user an instance for FileViewer
         isInstance = true; //indicating that we're creating an instance for class
         return new FileViewer(parent, filePath, fileName); //return the new instance
@@ -67,14 +84,17 @@ FileViewer* FileViewer::getInstance(QWidget* parent, const QString& filePath, co
 
 /**
  * @brief Method for opening a file, return true if opened file successfully.
- * @param QString filePath
- * @return FileViewer* viewer
+ * @brief File is mapped for reading only, pages are read by the system when their rows are shown.
+ * @param string filePath
+ * @return bool result
  */
-bool FileViewer::openFile(const QString& filePath) {
-    if (this->file.open(QIODevice::ReadOnly)) { //if true we opened the file successfully
+bool FileViewer::openFile(const string& filePath) {
+    this->filePath = File::NativePath(filePath); //save the native path of file for searches
+    if (this->file.open(this->filePath, true)) { //if true we opened the file successfully
         this->fileSize = this->file.size(); //set size file 
-        this->bytesRead = 0; //set starting bytesRead to zero
-        this->loadChunk();  //load the initial chunk
+        this->topRow = 0; //set starting row to the beginning of file
+        this->updateScrollRange(); //set the range of scroll bar for file size
+        this->renderRows();  //show the initial rows
         return true; //return true indicating for successful file opening
     }
     else //else we couldn't open file
@@ -83,21 +103,71 @@ bool FileViewer::openFile(const QString& filePath) {
 
 
 /**
- * @brief Method to set the position of scroll bar to the start position when show() method is called.
+ * @brief Method to measure the rows that fit in FileTextEdit and show them when show() method is called.
  * @param QShowEvent event
  */
 void FileViewer::showEvent(QShowEvent* event) {
     QDialog::showEvent(event); //call the base class implementation
-    ui.FileTextEdit->verticalScrollBar()->setValue(ui.FileTextEdit->verticalScrollBar()->minimum()); //set the scrollbar value to the minimum position
+    int lineHeight = max(ui.FileTextEdit->fontMetrics().lineSpacing(), 1); //represents the height of each row
+    int margins = (int)(2 * ui.FileTextEdit->document()->documentMargin()); //represents the margins of document above and below rows
+    this->visibleRows = (size_t)max((ui.FileTextEdit->viewport()->height() - margins) / lineHeight, 1); //set the amount of rows that fit in view
+    this->updateScrollRange(); //page of scroll bar depends on visible rows
+    this->scrollToRow(this->topRow); //show the rows that fit in view
+}
+
+
+/**
+ * @brief Method for handling the mouse wheel and scrolling keys of FileTextEdit, its own scroll bars only see the visible rows
+ * @brief so we scroll the file rows instead. Returns true if event was handled.
+ * @param QObject* object
+ * @param QEvent* event
+ * @return bool result
+ */
+bool FileViewer::eventFilter(QObject* object, QEvent* event) {
+    if (event->type() == QEvent::Wheel && object == ui.FileTextEdit->viewport()) { //if true we scroll the rows with mouse wheel
+        QWheelEvent* wheelEvent = static_cast<QWheelEvent*>(event);
+        if (wheelEvent->angleDelta().y() == 0) //if true it's a horizontal scroll, FileTextEdit handles it
+            return QDialog::eventFilter(object, event);
+        this->wheelDelta += wheelEvent->angleDelta().y(); //add the rotation to the rotation that didn't scroll yet
+        int steps = this->wheelDelta / QWheelEvent::DefaultDeltasPerStep; //represents the full wheel steps, each one is 120 units
+        this->wheelDelta -= steps * QWheelEvent::DefaultDeltasPerStep; //keep the remainder for next event
+        if (steps != 0) //if true we scroll, rotating away from user scrolls up
+            this->scrollBy(-(long long)steps * WheelRows);
+        return true;
+    }
+    if (event->type() == QEvent::KeyPress && object == ui.FileTextEdit) { //if true we scroll the rows with keyboard
+        switch (static_cast<QKeyEvent*>(event)->key()) {
+        case Qt::Key_Up: this->scrollBy(-1); return true; //scroll one row up
+        case Qt::Key_Down: this->scrollBy(1); return true; //scroll one row down
+        case Qt::Key_PageUp: this->scrollBy(-(long long)this->visibleRows); return true; //scroll one page up
+        case Qt::Key_PageDown: this->scrollBy((long long)this->visibleRows); return true; //scroll one page down
+        case Qt::Key_Home: this->scrollToRow(0); return true; //scroll to the beginning of file
+        case Qt::Key_End: this->scrollToRow(this->getMaxTopRow()); return true; //scroll to the end of file
+        default: break;
+        }
+    }
+    if (event->type() == QEvent::MouseButtonPress && object == ui.AnalysisLabel) { //if true user clicked the analysis panel
+        QMouseEvent* mouseEvent = static_cast<QMouseEvent*>(event);
+        this->chartClicked(mouseEvent->pos().x(), mouseEvent->pos().y()); //show the block of clicked column
+        return true;
+    }
+    return QDialog::eventFilter(object, event); //else we pass the event to base class
 }
 
 
 /**
- * @brief Method for updating file text edit content with chosen format.
+ * @brief Method for updating file text edit content with chosen format, first visible byte stays in view. Last index shows the analysis panel.
  * @param int index
  */
 void FileViewer::updateFileContent(int index) {
+    if (index == 3) { //if true we show the analysis of file, rows keep their format and position
+        this->showAnalysis(true);
+        return;
+    }
+    if (this->isAnalysisShown) //if true we go back from analysis to rows
+        this->showAnalysis(false);
     string oldFormat = this->format; //save old format for checking later if it has been changed
+    size_t offset = this->topRow * this->getBytesPerRow(); //represents the offset of first visible byte in old format
     if(index == 0)  //read and display the file as HEX
         this->format = "HEX";
     else if(index == 1) //read and display the file as BINARY
@@ -105,57 +175,431 @@ void FileViewer::updateFileContent(int index) {
     else if (index == 2) //read and display the file as UTF-8
         this->format = "UTF-8";
     if (oldFormat != this->format) { //means that format was changed
-        //disconnect the scrollbar signal before changing format
-        disconnect(ui.FileTextEdit->verticalScrollBar(), &QScrollBar::valueChanged, this, &FileViewer::loadChunk);
-        //we reset the file's reading progress to the beginning
-        this->bytesRead = 0; //set bytesRead back to zero
-        ui.FileTextEdit->clear(); //clear the FileTextEdit
-        this->file.seek(0);  //reset file pointer to beginning
-        this->loadChunk();  //load the initial chunk again with current format
-        ui.FileTextEdit->verticalScrollBar()->setValue(ui.FileTextEdit->verticalScrollBar()->minimum()); //ser the scroll bar back to the beginning
-        //reconnect the scrollbar signal after changing format
-        connect(ui.FileTextEdit->verticalScrollBar(), &QScrollBar::valueChanged, this, &FileViewer::loadChunk);
+        this->updateScrollRange(); //each format has its own amount of rows
+        this->scrollToRow(offset / this->getBytesPerRow()); //show the row of first visible byte in new format
+    }
+}
+
+
+/**
+ * @brief Method that is called when user moves the scroll bar, shows the rows of scroll position.
+ * @param int value
+ */
+void FileViewer::scrollMoved(int value) {
+    this->topRow = min(this->toRow(value), this->getMaxTopRow()); //set the first visible row of scroll position
+    this->renderRows(); //show the rows
+}
+
+
+/**
+ * @brief Method for jumping to the offset user entered, offsets with 0x prefix are HEX and others are decimal.
+ */
+void FileViewer::goToOffset() {
+    QString input = ui.OffsetLineEdit->text().trimmed(); //represents the offset user entered
+    bool isValid = false; //flag for indicating that input is a number
+    qulonglong offset = input.startsWith("0x", Qt::CaseInsensitive) ? input.mid(2).toULongLong(&isValid, 16) : input.toULongLong(&isValid, 10); //parse the offset
+    if (!isValid || offset >= this->fileSize) { //if true the offset is not in file
+        QMessageBox::warning(this, "Invalid Offset", QString("Please enter an offset between 0 and %1, use 0x prefix for HEX offsets.").arg((qulonglong)(this->fileSize > 0 ? this->fileSize - 1 : 0))); //show messagebox with error
+        return;
+    }
+    this->scrollToRow((size_t)offset / this->getBytesPerRow()); //show the row of offset, rows near the end of file show the last page
+}
+
+
+/**
+ * @brief Method that is called when user clicks the search button, stops the running search or starts a new one.
+ */
+void FileViewer::searchClicked() {
+    if (this->search != NULL && !this->search->getIsFinished()) { //if true search is running so we stop it
+        this->search->stop(); //stop the worker, hits found so far stay listed
+        this->updateSearch(); //show the last hits and the result
+    }
+    else //else we start a new search
+        this->startSearch();
+}
+
+
+/**
+ * @brief Method for starting a search of the bytes user entered, HEX input is parsed to bytes and text is searched as UTF-8.
+ * @brief A running search is stopped first and its hits are cleared.
+ */
+void FileViewer::startSearch() {
+    vector<unsigned char> pattern; //represents the searched bytes
+    QString input = ui.SearchLineEdit->text(); //represents the input of user
+    if (ui.SearchTypeComboBox->currentIndex() == 0) { //if true we search HEX bytes
+        if (!PatternSearch::ParseHex(input.toStdString(), pattern)) { //if true input isn't HEX bytes
+            QMessageBox::warning(this, "Invalid Search", "Please enter the bytes as pairs of HEX digits, for example 4D 5A 90 00."); //show messagebox with error
+            return;
+        }
+    }
+    else { //else we search text
+        QByteArray bytes = input.toUtf8(); //represents the UTF-8 bytes of text
+        if (bytes.isEmpty()) { //if true there's nothing to search
+            QMessageBox::warning(this, "Invalid Search", "Please enter the text to search for."); //show messagebox with error
+            return;
+        }
+        pattern.assign(bytes.begin(), bytes.end());
+    }
+
+    this->searchTimer->stop(); //stop collecting the hits of previous search
+    this->search.reset(); //stop the previous search and wait for its worker
+    ui.SearchResultsList->clear(); //clear the hits of previous search
+    this->search = make_unique<PatternSearch>(pattern); //create the search
+    if (!this->search->start(this->filePath)) { //if true we couldn't open the file
+        this->search.reset();
+        ui.SearchStatusLabel->setText("Failed opening the file");
+        return;
+    }
+    ui.SearchButton->setText("Stop"); //button stops the running search
+    this->searchTimer->start(); //start collecting the hits
+    this->updateSearch(); //show the initial status
+}
+
+
+/**
+ * @brief Method for adding the new hits of search to the results list and showing its progress, called by the search timer.
+ */
+void FileViewer::updateSearch() {
+    if (this->search == NULL) //if true there's no search
+        return;
+    bool isFinished = this->search->getIsFinished(); //check before taking the hits, so hits of last chunk are taken too
+    vector<size_t> hits; //represents the new hits
+    this->search->takeHits(hits);
+    for (size_t hit : hits) { //add each hit to results list
+        QListWidgetItem* item = new QListWidgetItem("0x" + QString("%1").arg((qulonglong)hit, (int)ByteFormat::OffsetDigits, 16, QChar('0')).toUpper(), ui.SearchResultsList); //show the offset of hit, same as in offset box
+        item->setData(Qt::UserRole, (qulonglong)hit); //save the offset of hit for showing its row
+    }
+
+    size_t hitCount = this->search->getHitCount(); //represents the amount of hits found
+    if (!isFinished) { //if true search is running so we show its progress
+        size_t fileSize = max(this->search->getFileSize(), (size_t)1); //represents the size of file, empty files have no progress
+        ui.SearchStatusLabel->setText(QString("Searching... %1% - %2 hits").arg((int)(100 * this->search->getBytesScanned() / fileSize)).arg((qulonglong)hitCount));
+        return;
+    }
+    this->searchTimer->stop(); //search finished so we stop collecting
+    ui.SearchButton->setText("Search"); //button starts a new search
+    QString status = QString("%1 %2 hits").arg(this->search->getIsFailed() ? "Failed reading -" : this->search->getIsStopped() ? "Stopped -" : "Found").arg((qulonglong)hitCount); //represents the result of search
+    if (hitCount > PatternSearch::MaxHits) //if true only the first hits are listed
+        status += QString(", %1 listed").arg((qulonglong)PatternSearch::MaxHits);
+    ui.SearchStatusLabel->setText(status);
+}
+
+
+/**
+ * @brief Method that is called when user clicks a hit, shows the row of its offset.
+ * @param QListWidgetItem* item
+ */
+void FileViewer::resultClicked(QListWidgetItem* item) {
+    size_t offset = (size_t)item->data(Qt::UserRole).toULongLong(); //represents the offset of hit
+    this->scrollToRow(offset / this->getBytesPerRow()); //show the row of hit, rows near the end of file show the last page
+}
+
+
+/**
+ * @brief Method for getting the amount of bytes in each row of current format.
+ */
+size_t FileViewer::getBytesPerRow() const {
+    if (this->format == "BINARY") //each byte takes 9 characters
+        return ByteFormat::BinaryRowBytes;
+    else if (this->format == "UTF-8") //text rows hold more bytes
+        return FileViewer::TextRowBytes;
+    return ByteFormat::HexRowBytes;
+}
+
+
+/**
+ * @brief Method for getting the last row that can be the first visible row, so the last page is full.
+ */
+size_t FileViewer::getMaxTopRow() const {
+    size_t bytesPerRow = this->getBytesPerRow(); //represents the bytes of each row
+    size_t totalRows = (this->fileSize + bytesPerRow - 1) / bytesPerRow; //represents the amount of rows of file
+    return (totalRows > this->visibleRows) ? totalRows - this->visibleRows : 0;
+}
+
+
+/**
+ * @brief Method for converting a row to scroll bar value, rows are scaled when file has more rows than range of scroll bar.
+ * @param size_t row
+ */
+int FileViewer::toScrollValue(size_t row) const {
+    size_t maxTopRow = this->getMaxTopRow(); //represents the last first visible row
+    if (maxTopRow <= (size_t)FileViewer::ScrollSteps) //if true each value of scroll bar is a row
+        return (int)row;
+    return (int)((long double)row * FileViewer::ScrollSteps / maxTopRow); //scale the row to range of scroll bar
+}
+
+
+/**
+ * @brief Method for converting a scroll bar value to row, values are scaled when file has more rows than range of scroll bar.
+ * @param int value
+ */
+size_t FileViewer::toRow(int value) const {
+    size_t maxTopRow = this->getMaxTopRow(); //represents the last first visible row
+    if (maxTopRow <= (size_t)FileViewer::ScrollSteps) //if true each value of scroll bar is a row
+        return (size_t)value;
+    return (size_t)((long double)value * maxTopRow / FileViewer::ScrollSteps); //scale the value to rows of file
+}
+
+
+/**
+ * @brief Method for setting the range and page of scroll bar for current format and view size.
+ */
+void FileViewer::updateScrollRange() {
+    size_t maxTopRow = this->getMaxTopRow(); //represents the last first visible row
+    QSignalBlocker blocker(ui.FileScrollBar); //changing the range must not move the view
+    ui.FileScrollBar->setRange(0, (int)min(maxTopRow, (size_t)FileViewer::ScrollSteps)); //set the range of scroll bar
+    ui.FileScrollBar->setPageStep(max(this->toScrollValue(this->visibleRows), 1)); //page of scroll bar is the visible rows
+    ui.FileScrollBar->setSingleStep(max(this->toScrollValue(1), 1)); //step of scroll bar is one row
+}
+
+
+/**
+ * @brief Method for showing the rows starting at given row and moving the scroll bar to them.
+ * @param size_t row
+ */
+void FileViewer::scrollToRow(size_t row) {
+    this->topRow = min(row, this->getMaxTopRow()); //set the first visible row, last page is always full
+    QSignalBlocker blocker(ui.FileScrollBar); //we already show the rows, scroll bar only follows
+    ui.FileScrollBar->setValue(this->toScrollValue(this->topRow)); //move the scroll bar to row
+    this->renderRows(); //show the rows
+}
+
+
+/**
+ * @brief Method for scrolling the view by given amount of rows, negative amount scrolls up.
+ * @param long long rows
+ */
+void FileViewer::scrollBy(long long rows) {
+    if (rows < 0) //if true we scroll up until the first row
+        this->scrollToRow(this->topRow > (size_t)(-rows) ? this->topRow - (size_t)(-rows) : 0);
+    else //else we scroll down, scrollToRow stops at the last page
+        this->scrollToRow(this->topRow + (size_t)rows);
+}
+
+
+/**
+ * @brief Method for formatting the visible rows from mapped file and showing them in FileTextEdit.
+ * @brief Only the bytes of visible rows are read, so the cost is the same for any position in any file size.
+ * @brief HEX and BINARY rows are written by SIMD kernels straight into the buffer of text, UTF-8 rows are decoded one row at a time.
+ */
+void FileViewer::renderRows() {
+    size_t bytesPerRow = this->getBytesPerRow(); //represents the bytes of each row
+    size_t offset = this->topRow * bytesPerRow; //represents the offset of first visible byte
+    QString text; //represents the text of visible rows
+    if (offset < this->fileSize) { //if true there are bytes to show
+        size_t length = min(this->visibleRows * bytesPerRow, this->fileSize - offset); //represents the amount of visible bytes
+        size_t available = min(length + 3, this->fileSize - offset); //represents the mapped bytes, last UTF-8 row may end with a sequence of up to 3 more bytes
+        const unsigned char* data = this->file.map(offset, available); //get the visible bytes from mapped window
+        if (data == NULL) //if true we failed mapping the rows
+            text = "Failed reading the file. This could be due to the file being changed or securely deleted as part of the wiping process.";
+        else if (this->format == "HEX" || this->format == "BINARY") { //if format is HEX or BINARY we dump the rows into text
+            bool isHex = this->format == "HEX"; //flag for indicating HEX rows
+            text.resize((int)(isHex ? ByteFormat::HexDumpSize(length) : ByteFormat::BinaryDumpSize(length))); //allocate the characters of all rows once
+            char16_t* begin = reinterpret_cast<char16_t*>(text.data()); //QChar is a UTF-16 code unit, kernels write into text directly
+            char16_t* end = isHex ? ByteFormat::HexDump(data, length, offset, begin) : ByteFormat::BinaryDump(data, length, offset, begin); //write the rows
+            text.truncate((int)(end - begin)); //remove the new line after last row
+        }
+        else { //else format is UTF-8
+            for (size_t row = 0; row < length; row += bytesPerRow) { //format each visible row
+                if (row > 0) //rows are separated with new line
+                    text += '\n';
+                this->appendTextRow(text, data + row, offset + row, min(bytesPerRow, length - row), available - row);
+            }
+        }
     }
+    ui.FileTextEdit->setPlainText(text); //show the rows
+    ui.FileTextEdit->verticalScrollBar()->setValue(0); //view starts at first row
 }
 
 
 /**
- * @brief Method to load chunks of data to the FileTextEdit when scroll bar emits signal for value change.
+ * @brief Method for formatting a UTF-8 row of file with its offset and appending it to text, sequences that cross rows are shown in the row they start.
+ * @param QString text
+ * @param const unsigned char* data
+ * @param size_t offset
+ * @param size_t length
+ * @param size_t available
  */
-void FileViewer::loadChunk() {
-    const qint64 DefaultChunkSize = 2048 * 3;  //setting DefaultChuckSize that will add each time
+void FileViewer::appendTextRow(QString& text, const unsigned char* data, size_t offset, size_t length, size_t available) {
+    text += QString("%1  ").arg((qulonglong)offset, (int)ByteFormat::OffsetDigits, 16, QChar('0')).toUpper(); //add the offset of row
+    size_t start = 0; //represents the start of text in row
+    while (start < length && start < 3 && (data[start] & 0xC0) == 0x80) //skip the continuation bytes of sequence of previous row
+        start++;
+    size_t end = length; //represents the end of text in row
+    for (size_t back = 1; back <= min(length, (size_t)3); back++) { //find the lead byte of last sequence
+        unsigned char lead = data[length - back];
+        if ((lead & 0xC0) != 0x80) { //if true we found the lead byte, we extend the row to finish its sequence
+            size_t sequence = (lead >= 0xF0) ? 4 : (lead >= 0xE0) ? 3 : (lead >= 0xC0) ? 2 : 1; //represents the length of sequence
+            if (sequence > back)
+                end = min(length - back + sequence, available);
+            break;
+        }
+    }
+    string line = Utf8::ToDisplay(string_view((const char*)data + start, end - start)); //invalid sequences are replaced
+    for (char& c : line) //control characters would break the rows, they're shown as dots
+        if ((unsigned char)c < 0x20 || c == 0x7F)
+            c = '.';
+    text += QString::fromUtf8(line.data(), (int)line.size()); //add the text of row
+}
+
 
-    if (!this->file.isOpen() || this->bytesRead >= this->fileSize) { //if true we loaded all the file contents
-        return;  //no more data to load, finish the task
+/**
+ * @brief Method for switching between the rows and analysis panel, analysis of file starts when the panel is shown for the first time.
+ * @param bool state
+ */
+void FileViewer::showAnalysis(bool state) {
+    this->isAnalysisShown = state; //set the flag of analysis mode
+    ui.FileTextEdit->setVisible(!state); //panel takes the place of rows and scroll bar
+    ui.FileScrollBar->setVisible(!state);
+    ui.AnalysisLabel->setVisible(state);
+    if (!state) { //if true rows are shown, a running analysis continues without updating the panel
+        this->analysisTimer->stop();
+        return;
     }
+    if (this->analysis == NULL) { //if true file wasn't analyzed yet
+        this->analysis = make_unique<ByteAnalysis>(); //create the analysis with a thread for each core
+        if (!this->analysis->start(this->filePath)) { //if true we couldn't open the file
+            this->analysis.reset();
+            ui.AnalysisLabel->setText("Failed opening the file. This could be due to the file being securely deleted as part of the wiping process.");
+            return;
+        }
+    }
+    if (!this->analysis->getIsFinished()) //if true we collect the windows until analysis finishes
+        this->analysisTimer->start();
+    this->updateAnalysis(); //show the current results
+}
+
 
-    qint64 remainingBytes = this->fileSize - this->bytesRead; //set the remaining bytes parameter
-    qint64 chunkSize = qMin(DefaultChunkSize, remainingBytes); //we set chunkSize to be the minimum between remaining bytes and a default parameter
+/**
+ * @brief Method for collecting the analyzed windows and histogram and drawing the panel, called by the analysis timer.
+ */
+void FileViewer::updateAnalysis() {
+    if (this->analysis == NULL) //if true there's no analysis
+        return;
+    bool isFinished = this->analysis->getIsFinished(); //check before collecting, so windows of last tasks are collected too
+    vector<AnalysisWindow> windows; //represents the windows of file
+    this->analysis->getWindows(windows);
+    ByteAnalysis::Downsample(windows, FileViewer::ChartColumns, this->analysisStrip); //each column of chart shows the windows of its part of file
+    this->analysis->getHistogram(this->analysisHistogram);
+    if (isFinished) //if true there's nothing more to collect
+        this->analysisTimer->stop();
+    this->renderAnalysis(); //draw the panel
+}
 
-    //read and append data only if the scrollbar position is near the bottom
-    QScrollBar* scrollbar = ui.FileTextEdit->verticalScrollBar(); //get a pointer to the scroll bar
-    int triggerPoint = scrollbar->maximum() - 5 * scrollbar->pageStep(); //set the trigger point for scroll bar for the signal for next chunk to be loaded
 
-    if (scrollbar->value() >= triggerPoint) { //if true we need to load more data to FileTextEdit
-        QByteArray buffer = this->file.read(chunkSize); //read the chunkSize bytes from file and store it in a byte array
-        QString data = ""; //represents the data of buffer 
-        if (this->format == "HEX") //if format is HEX
-            data = buffer.toHex(' ').toUpper(); //we add data as HEX 
-        else if (this->format == "UTF-8") //else if format is UTF-8
-            data = QString::fromStdString(buffer.toStdString()); //add the data as UTF-8 
-        else if (this->format == "BINARY") { //else format is BINARY
-            vector<QString> binaryData(buffer.size()); //set the binary data array with buffer size
-            //we use transform method to generate byte format for each value in buffer using lambda function
-            transform(buffer.begin(), buffer.end(), binaryData.begin(), [](char c) { 
-                return QString::number(static_cast<unsigned char>(c), 2).rightJustified(8, '0'); });
-            QStringList binaryDataList = QStringList::fromVector(QVector<QString>(binaryData.begin(), binaryData.end())); //we create QStringList for saving the binary data 
-            data = binaryDataList.join(" ").trimmed(); //join the strings with spaces and remove the trailing space
+/**
+ * @brief Method for drawing the analysis panel, the summary of file, the entropy chart and the byte histogram.
+ * @brief Each column of chart is filled up to the mean entropy of its windows, columns with a block below LowEntropy are marked red down to that block.
+ */
+void FileViewer::renderAnalysis() {
+    QImage image(ui.AnalysisLabel->width(), ui.AnalysisLabel->height(), QImage::Format_ARGB32_Premultiplied); //represents the panel
+    image.fill(Qt::transparent); //background comes from style of label
+    QPainter painter(&image);
+    painter.setRenderHint(QPainter::Antialiasing, false); //columns are single pixels
+    painter.setFont(ui.AnalysisLabel->font());
+    QColor barColor(68, 70, 84), lowColor(200, 0, 0), axisColor(102, 102, 102); //represents the colors of bars, low-entropy marks and axes
+
+    uint64_t total = 0; //represents the amount of analyzed bytes in histogram
+    for (uint64_t count : this->analysisHistogram)
+        total += count;
+    size_t lowest = this->analysisStrip.size(); //represents the column with the lowest block, size if none was analyzed
+    size_t lowColumns = 0; //represents the amount of columns with a low-entropy block
+    for (size_t column = 0; column < this->analysisStrip.size(); column++) {
+        if (!this->analysisStrip[column].isDone)
+            continue;
+        if (lowest == this->analysisStrip.size() || this->analysisStrip[column].minEntropy < this->analysisStrip[lowest].minEntropy)
+            lowest = column;
+        if (this->analysisStrip[column].minEntropy < ByteAnalysis::LowEntropy)
+            lowColumns++;
+    }
+
+    QString status; //represents the first line of summary
+    if (!this->analysis->getIsFinished()) { //if true analysis is running so we show its progress
+        size_t fileSize = max(this->analysis->getFileSize(), (size_t)1); //represents the size of file, empty files have no progress
+        status = QString("Analyzing... %1%").arg((int)(100 * this->analysis->getBytesAnalyzed() / fileSize));
+    }
+    else { //else we show the entropy and chi-square score of file
+        double chiSquare = ByteAnalysis::ChiSquare(this->analysisHistogram.data(), total); //represents the chi-square score of file
+        status = QString("%1Entropy %2 bits/byte - Chi-square %3 (p = %4) - %5 MB").arg(this->analysis->getIsFailed() ? "Failed reading part of file - " : "")
+            .arg(ByteAnalysis::Entropy(this->analysisHistogram.data(), total), 0, 'f', 5).arg(chiSquare, 0, 'f', 1).arg(ByteAnalysis::ChiSquareProbability(chiSquare), 0, 'f', 3)
+            .arg((double)total / (1024 * 1024), 0, 'f', 1);
+    }
+    QString summary; //represents the second line of summary
+    if (lowest == this->analysisStrip.size()) //if true no window was analyzed yet
+        summary = "";
+    else if (lowColumns == 0) //if true all blocks look random
+        summary = QString("No block below %1 bits/byte, lowest %2").arg(ByteAnalysis::LowEntropy, 0, 'f', 1).arg(this->analysisStrip[lowest].minEntropy, 0, 'f', 3);
+    else //else we show where the lowest block is
+        summary = QString("Lowest block %1 bits/byte at 0x%2 - click red columns to show their blocks").arg(this->analysisStrip[lowest].minEntropy, 0, 'f', 3)
+            .arg(QString("%1").arg((qulonglong)this->analysisStrip[lowest].minOffset, (int)ByteFormat::OffsetDigits, 16, QChar('0')).toUpper());
+    painter.setPen(Qt::black);
+    painter.drawText(ChartLeft - 35, 25, status);
+    painter.drawText(ChartLeft - 35, 45, summary);
+
+    int chartBottom = ChartTop + ChartHeight; //represents the bottom edge of chart, 0 bits per byte
+    painter.setPen(axisColor);
+    painter.drawRect(ChartLeft - 1, ChartTop - 1, ChartColumns + 1, ChartHeight + 1); //frame of chart
+    for (int bits = 0; bits <= 8; bits += 2) //scale of entropy
+        painter.drawText(ChartLeft - 20, chartBottom - bits * ChartHeight / 8 + 5, QString::number(bits));
+    for (size_t column = 0; column < this->analysisStrip.size(); column++) { //draw each analyzed column
+        const AnalysisWindow& window = this->analysisStrip[column];
+        if (!window.isDone)
+            continue;
+        int x = ChartLeft + (int)column; //represents the x of column
+        int meanY = chartBottom - (int)(window.entropy * ChartHeight / 8); //represents the y of mean entropy
+        int minY = chartBottom - (int)(window.minEntropy * ChartHeight / 8); //represents the y of lowest block
+        painter.setPen(barColor);
+        painter.drawLine(x, chartBottom - 1, x, meanY);
+        if (window.minEntropy < ByteAnalysis::LowEntropy) { //if true column has a low-entropy block
+            painter.setPen(lowColor);
+            painter.drawLine(x, minY, x, min(meanY, minY - 1)); //mark the column from its lowest block, at least one pixel
+            painter.drawLine(x, chartBottom - 1, x, chartBottom - 4); //mark the base so columns with low mean show too
         }
-        //disconnect the scrollbar signal before appending text
-        disconnect(scrollbar, &QScrollBar::valueChanged, this, &FileViewer::loadChunk);
-        ui.FileTextEdit->append(data); //append the data to FileTextEdit
-        this->bytesRead += chunkSize; // add the appended amount of data to our bytesRead parameter
-        //reconnect the scrollbar signal after appending text
-        connect(scrollbar, &QScrollBar::valueChanged, this, &FileViewer::loadChunk);
     }
+    int lowY = chartBottom - (int)(ByteAnalysis::LowEntropy * ChartHeight / 8); //represents the y of LowEntropy
+    painter.setPen(QPen(lowColor, 1, Qt::DashLine));
+    painter.drawLine(ChartLeft, lowY, ChartLeft + ChartColumns - 1, lowY); //line of LowEntropy
+    painter.setPen(Qt::black);
+    size_t fileSize = this->analysis->getFileSize(); //represents the size of file
+    painter.drawText(ChartLeft, chartBottom + 18, "0x0");
+    QString endOffset = "0x" + QString("%1").arg((qulonglong)fileSize, 0, 16).toUpper(); //represents the end of file
+    painter.drawText(QRect(ChartLeft, chartBottom + 5, ChartColumns, 20), Qt::AlignRight | Qt::AlignTop, endOffset);
+
+    int histogramBottom = HistogramTop + HistogramHeight; //represents the bottom edge of histogram
+    painter.drawText(ChartLeft, HistogramTop - 8, "Byte histogram");
+    painter.setPen(axisColor);
+    painter.drawRect(ChartLeft - 1, HistogramTop - 1, ChartColumns + 1, HistogramHeight + 1); //frame of histogram
+    uint64_t maxCount = 0; //represents the highest count, bars are scaled to it
+    for (uint64_t count : this->analysisHistogram)
+        maxCount = max(maxCount, count);
+    for (size_t value = 0; value < this->analysisHistogram.size() && maxCount > 0; value++) { //draw the bar of each byte value
+        double height = (double)this->analysisHistogram[value] * HistogramHeight / maxCount; //represents the height of bar
+        painter.fillRect(QRectF(ChartLeft + value * (double)ChartColumns / 256, histogramBottom - height, (double)ChartColumns / 256, height), barColor);
+    }
+    if (maxCount > 0) { //line of count of uniform bytes
+        int uniformY = histogramBottom - (int)((double)total / 256 * HistogramHeight / maxCount); //represents the y of uniform count
+        painter.setPen(QPen(lowColor, 1, Qt::DashLine));
+        painter.drawLine(ChartLeft, uniformY, ChartLeft + ChartColumns - 1, uniformY);
+    }
+    painter.setPen(Qt::black);
+    for (int value = 0; value <= 256; value += 64) //scale of byte values
+        painter.drawText(ChartLeft + value * ChartColumns / 256 - (value == 256 ? 16 : 0), histogramBottom + 18, QString("%1").arg(min(value, 255), 2, 16, QChar('0')).toUpper());
+    painter.end();
+    ui.AnalysisLabel->setPixmap(QPixmap::fromImage(image)); //show the panel
+}
+
+
+/**
+ * @brief Method for showing the lowest block of clicked column of entropy chart, rows are shown again in their format.
+ * @param int x
+ * @param int y
+ */
+void FileViewer::chartClicked(int x, int y) {
+    size_t column = (size_t)(x - ChartLeft); //represents the clicked column
+    if (x < ChartLeft || column >= this->analysisStrip.size() || y < ChartTop || y >= ChartTop + ChartHeight || !this->analysisStrip[column].isDone) //if true click isn't on an analyzed column
+        return;
+    size_t offset = this->analysisStrip[column].minOffset; //represents the offset of lowest block of column
+    int index = (this->format == "BINARY") ? 1 : (this->format == "UTF-8") ? 2 : 0; //represents the index of format of rows
+    ui.FormatComboBox->setCurrentIndex(index); //show the rows, combo box calls updateFileContent
+    this->scrollToRow(offset / this->getBytesPerRow()); //show the row of block
 }
\ No newline at end of file
@@ -4,38 +4,95 @@
 #include <QtWidgets/QMainWindow>
 #include <QMessageBox>
 #include <QScrollBar>
+#include <QWheelEvent>
+#include <QKeyEvent>
+#include <QMouseEvent>
+#include <QPainter>
+#include <QImage>
+#include <QPixmap>
+#include <QListWidget>
+#include <QTimer>
 #include <iostream>
 #include <string.h>
 #include <vector>
+#include <memory>
 #include <QTextEdit>
-#include <QFile>
+#include "File.h"
+#include "IO/MmapBackend.h"
+#include "ByteFormat.h"
+#include "PatternSearch.h"
+#include "ByteAnalysis.h"
 #include "ui_FileViewer.h"  
 
 using namespace std;
 
 /**
  * @brief Class for file viewing in various formats.
+ * @brief The file is memory-mapped for reading and only the rows that fit in the view are formatted, so memory stays constant
+ * @brief for any file size and scroll position maps directly to file offset.
+ * @brief Patterns are searched on a background thread over a separate mapping, hits are listed as they're found and clicking one shows its row.
+ * @brief Analysis mode shows the entropy of the whole file as a strip chart and its byte histogram, for checking wiped and encrypted files.
  */
 class FileViewer : public QDialog {
     Q_OBJECT
 
 private:
     Ui::FileViewer ui; //ui element for window
-    QFile file; //QFile object for opening file
-    qint64 fileSize = 0; //qint64 for fileSize
-    qint64 bytesRead = 0; //qint64 for amount of bytes read
+    MappedFile file; //read-only mapping of file, only the window around visible rows is mapped
+    size_t fileSize = 0; //represents the size of file
+    size_t topRow = 0; //represents the first row shown in FileTextEdit
+    size_t visibleRows = 1; //represents the amount of rows that fit in FileTextEdit
+    int wheelDelta = 0; //represents the wheel rotation that didn't scroll a row yet, touchpads send small steps
     string format = "HEX"; //format string for text
-    FileViewer(QWidget* parent, const QString& filePath, const QString& fileName); //private constructor for class
+    filesystem::path filePath; //represents the native path of file, search opens its own mapping
+    unique_ptr<PatternSearch> search; //represents the current search of file, NULL if nothing was searched yet
+    QTimer* searchTimer = NULL; //timer that collects the hits and progress of running search
+    unique_ptr<ByteAnalysis> analysis; //represents the analysis of file, started when analysis mode is first shown
+    QTimer* analysisTimer = NULL; //timer that collects the windows and progress of running analysis
+    bool isAnalysisShown = false; //flag for indicating that analysis panel is shown instead of rows
+    vector<AnalysisWindow> analysisStrip; //represents the columns of entropy chart
+    vector<uint64_t> analysisHistogram; //represents the byte histogram of analyzed chunks
+    static constexpr size_t TextRowBytes = 64; //amount of bytes in each UTF-8 row
+    static constexpr int ScrollSteps = 1 << 30; //maximal range of scroll bar, files with more rows map scroll position to row proportionally
+    static constexpr int WheelRows = 3; //amount of rows scrolled by each step of mouse wheel
+    static constexpr int SearchInterval = 100; //interval in milliseconds between updates of running search
+    static constexpr int AnalysisInterval = 200; //interval in milliseconds between updates of running analysis
+    static constexpr int ChartLeft = 50; //left edge of entropy chart and histogram in analysis panel
+    static constexpr int ChartColumns = 756; //width of entropy chart and histogram, each column of chart covers the same part of file
+    static constexpr int ChartTop = 65; //top edge of entropy chart
+    static constexpr int ChartHeight = 260; //height of entropy chart, from 0 to 8 bits per byte
+    static constexpr int HistogramTop = 375; //top edge of byte histogram
+    static constexpr int HistogramHeight = 130; //height of byte histogram
+    FileViewer(QWidget* parent, const string& filePath, const QString& fileName); //private constructor for class
     ~FileViewer(); //destructor for class
     FileViewer(const FileViewer&) = delete; //prevent copy
     void operator=(const FileViewer&) = delete; //prevent assignment
     static bool isInstance; //static bool instance flag for indication 
+    size_t getBytesPerRow() const;
+    size_t getMaxTopRow() const;
+    int toScrollValue(size_t row) const;
+    size_t toRow(int value) const;
+    void updateScrollRange();
+    void scrollToRow(size_t row);
+    void scrollBy(long long rows);
+    void renderRows();
+    void appendTextRow(QString& text, const unsigned char* data, size_t offset, size_t length, size_t available);
+    void showAnalysis(bool state);
+    void renderAnalysis();
+    void chartClicked(int x, int y);
 
 public:
-    static FileViewer* getInstance(QWidget* parent, const QString& filePath, const QString& fileName);
-    bool openFile(const QString& filePath);
+    static FileViewer* getInstance(QWidget* parent, const string& filePath, const QString& fileName);
+    bool openFile(const string& filePath);
     void showEvent(QShowEvent* event) override;
+    bool eventFilter(QObject* object, QEvent* event) override;
     void updateFileContent(int index);
-    void loadChunk();
+    void scrollMoved(int value);
+    void goToOffset();
+    void searchClicked();
+    void startSearch();
+    void updateSearch();
+    void resultClicked(QListWidgetItem* item);
+    void updateAnalysis();
 };
 #endif 
\ No newline at end of file
@@ -0,0 +1,72 @@
+#ifndef _AlignedBuffer_H
+#define _AlignedBuffer_H
+#define _CRT_SECURE_NO_WARNINGS
+#include <iostream>
+#include <string.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <new>
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+
+using namespace std;
+
+/**
+ * @brief Class that represents a page-aligned byte buffer, used for pooled I/O buffers so they can be passed to direct I/O.
+ * @brief Allocated size is rounded up to a multiple of Alignment, size returns the requested size.
+ */
+class AlignedBuffer {
+private:
+	unsigned char* buffer = NULL; //represents the aligned memory
+	size_t bufferSize = 0; //represents the requested size of buffer
+
+public:
+	static constexpr size_t Alignment = 4096; //alignment of buffer, page size and multiple of logical block size of storage devices
+
+	/**
+	 * @brief Constructor of class, allocates the aligned memory.
+	 * @param size_t size
+	 * @throws bad_alloc thrown if allocation failed.
+	 */
+	AlignedBuffer(size_t size = 0) : bufferSize(size) {
+		if (size == 0) //nothing to allocate
+			return;
+		size_t allocationSize = (size + AlignedBuffer::Alignment - 1) & ~(AlignedBuffer::Alignment - 1); //round size up to multiple of alignment
+#ifdef _WIN32
+		this->buffer = (unsigned char*)_aligned_malloc(allocationSize, AlignedBuffer::Alignment); //allocate aligned memory
+#else
+		this->buffer = (unsigned char*)aligned_alloc(AlignedBuffer::Alignment, allocationSize); //allocate aligned memory
+#endif
+		if (this->buffer == NULL) //if true we failed allocating
+			throw bad_alloc();
+	}
+
+	/**
+	 * @brief Destructor of class, releases the aligned memory.
+	 */
+	~AlignedBuffer() {
+#ifdef _WIN32
+		_aligned_free(this->buffer); //release aligned memory
+#else
+		free(this->buffer); //release aligned memory
+#endif
+	}
+
+	AlignedBuffer(const AlignedBuffer&) = delete; //prevent copy
+	void operator=(const AlignedBuffer&) = delete; //prevent assignment
+
+	/**
+	 * @brief Move constructor of class, takes the memory of other buffer.
+	 * @param AlignedBuffer other
+	 */
+	AlignedBuffer(AlignedBuffer&& other) noexcept : buffer(other.buffer), bufferSize(other.bufferSize) {
+		other.buffer = NULL; //other buffer no longer owns the memory
+		other.bufferSize = 0;
+	}
+
+	unsigned char* data() { return this->buffer; }
+	size_t size() { return this->bufferSize; }
+	unsigned char& operator[](size_t index) { return this->buffer[index]; }
+};
+#endif
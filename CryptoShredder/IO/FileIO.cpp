@@ -0,0 +1,426 @@
+#include "FileIO.h"
+#include "AlignedBuffer.h"
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#include <sys/stat.h>
+#ifdef __linux__
+#include <sys/sysmacros.h>
+#endif
+#endif
+
+
+/**
+ * @brief Constructor of class.
+ */
+FileIO::FileIO() {
+#ifdef _WIN32
+    this->fileHandle = INVALID_HANDLE_VALUE; //no file is open yet
+#endif
+}
+
+
+/**
+ * @brief Destructor of class.
+ */
+FileIO::~FileIO() {
+    this->close(); //ensure that the file is closed
+}
+
+
+/**
+ * @brief Method for opening the file for reading and writing, returns true on success.
+ * @brief If directIO is set we try to bypass the page cache, filesystems that reject it are opened with buffered I/O.
+ * @param path filePath
+ * @param bool directIO
+ */
+bool FileIO::open(const filesystem::path& filePath, bool directIO) {
+    this->close(); //close previous file if any
+    this->isDirect = false; //reset isDirect flag
+#ifdef _WIN32
+    if (directIO) { //if true we try to open the file without buffering
+        this->fileHandle = CreateFileW(filePath.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_NO_BUFFERING | FILE_FLAG_WRITE_THROUGH, NULL); //open the file for unbuffered reading and writing
+        this->isDirect = this->fileHandle != INVALID_HANDLE_VALUE; //set isDirect if we opened the file
+    }
+    if (!this->isDirect) //if true we open the file with buffered I/O
+        this->fileHandle = CreateFileW(filePath.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, NULL); //open the file for reading and writing, we access files sequentially
+    return this->fileHandle != INVALID_HANDLE_VALUE; //return true if we opened the file
+#else
+#ifdef O_DIRECT
+    if (directIO) { //if true we try to open the file without page cache
+        this->fd = ::open(filePath.c_str(), O_RDWR | O_CLOEXEC | O_DIRECT); //open the file for direct reading and writing
+        this->isDirect = this->fd != -1; //set isDirect if we opened the file, filesystems without direct I/O fail with EINVAL
+    }
+#endif
+    if (!this->isDirect) //if true we open the file with buffered I/O
+        this->fd = ::open(filePath.c_str(), O_RDWR | O_CLOEXEC); //open the file for reading and writing
+    return this->fd != -1; //return true if we opened the file
+#endif
+}
+
+
+/**
+ * @brief Method for reading or writing size bytes at given offset, returns the amount of bytes transferred or -1 on failure.
+ * @brief Only a read that reaches end of file transfers less than size bytes.
+ * @param unsigned char* buffer
+ * @param size_t size
+ * @param size_t offset
+ * @param bool write
+ */
+long long FileIO::transfer(unsigned char* buffer, size_t size, size_t offset, bool write) {
+    size_t transferred = 0; //represents the amount of bytes we transferred
+    while (size > 0) { //transfer until all bytes are done
+#ifdef _WIN32
+        OVERLAPPED overlapped{}; //represents the offset for positional transfer
+        overlapped.Offset = (DWORD)(offset & 0xFFFFFFFF);
+        overlapped.OffsetHigh = (DWORD)((unsigned long long)offset >> 32);
+        DWORD length = (DWORD)min(size, (size_t)0x40000000); //limit each request to 1GB, keeps direct requests aligned
+        DWORD result = 0; //represents the amount of bytes of this request
+        BOOL isSuccess = write ? WriteFile(this->fileHandle, buffer, length, &result, &overlapped) : ReadFile(this->fileHandle, buffer, length, &result, &overlapped); //transfer at given offset
+        if (!isSuccess && !write && GetLastError() == ERROR_HANDLE_EOF) //if true we reached end of file
+            break;
+        if (!isSuccess && GetLastError() == ERROR_INVALID_PARAMETER && this->isDirect && this->disableDirect()) //if true the device rejected unbuffered request, retry buffered
+            continue;
+        if (!isSuccess) //if true we failed the transfer
+            return -1;
+#else
+        ssize_t result = write ? pwrite(this->fd, buffer, size, (off_t)offset) : pread(this->fd, buffer, size, (off_t)offset); //transfer at given offset
+        if (result < 0 && errno == EINTR) //if true we got interrupted and retry
+            continue;
+        if (result < 0 && errno == EINVAL && this->isDirect && this->disableDirect()) //if true the filesystem rejected direct request, retry buffered
+            continue;
+        if (result < 0) //if true we failed the transfer
+            return -1;
+#endif
+        if (result == 0) { //if true we reached end of file or device wrote nothing
+            if (write) //writes must make progress
+                return -1;
+            break;
+        }
+        buffer += result; //advance the buffer
+        offset += result; //advance the offset
+        size -= result; //decrease remaining size
+        transferred += result; //increase transferred bytes
+        if (!write && this->isDirect && offset % AlignedBuffer::Alignment != 0) //if true a short direct read stopped at end of file
+            break;
+    }
+    return (long long)transferred; //return the amount of bytes transferred
+}
+
+
+/**
+ * @brief Method for reading or writing the unaligned part of a direct request through an aligned bounce buffer, returns true on success.
+ * @brief Each piece is padded to whole blocks, for writes the blocks are read first so bytes around the piece are kept,
+ * @brief and the file is truncated back if the padded tail was written past end of file.
+ * @param unsigned char* buffer
+ * @param size_t size
+ * @param size_t offset
+ * @param bool write
+ */
+bool FileIO::transferBounced(unsigned char* buffer, size_t size, size_t offset, bool write) {
+    const size_t alignment = AlignedBuffer::Alignment; //represents the alignment of direct requests
+    AlignedBuffer bounce(min(FileIO::BounceSize, ((size + offset % alignment + alignment - 1) / alignment) * alignment)); //create the bounce buffer for the padded blocks
+    while (size > 0) { //transfer until all bytes are done
+        size_t blockOffset = offset - offset % alignment; //align the offset down to block
+        size_t partSize = min(size, bounce.size() - (offset - blockOffset)); //represents the bytes of request that fit in the bounce buffer
+        size_t blockSize = ((offset - blockOffset + partSize + alignment - 1) / alignment) * alignment; //pad the piece to whole blocks
+        memset(bounce.data(), 0, blockSize); //bytes past end of file are read as zeros
+        long long bytesRead = this->transfer(bounce.data(), blockSize, blockOffset, false); //read the blocks that contain the piece
+        if (bytesRead < 0 || (!write && (size_t)bytesRead < offset - blockOffset + partSize)) //if true we failed reading or the piece is past end of file
+            return false;
+        if (write) { //if true we write the piece through the bounce buffer
+            size_t fileSize = this->size(); //represents the size of file before the padded write
+            memcpy(bounce.data() + (offset - blockOffset), buffer, partSize); //copy the piece into its blocks
+            if (this->transfer(bounce.data(), blockSize, blockOffset, true) != (long long)blockSize) //if true we failed writing the blocks
+                return false;
+            if (blockOffset + blockSize > fileSize && !this->truncate(max(fileSize, offset + partSize))) //if true the padding extended the file and we failed cutting it back
+                return false;
+        }
+        else
+            memcpy(buffer, bounce.data() + (offset - blockOffset), partSize); //copy the piece from its blocks
+        buffer += partSize; //advance the buffer
+        offset += partSize; //advance the offset
+        size -= partSize; //decrease remaining size
+    }
+    return true;
+}
+
+
+/**
+ * @brief Method for reading exactly size bytes from given offset, returns true on success.
+ * @brief In direct mode the aligned part is read straight into buffer and the rest goes through the bounce buffer.
+ * @param unsigned char* buffer
+ * @param size_t size
+ * @param size_t offset
+ */
+bool FileIO::readAt(unsigned char* buffer, size_t size, size_t offset) {
+    if (this->isDirect && offset % AlignedBuffer::Alignment == 0 && (uintptr_t)buffer % AlignedBuffer::Alignment == 0) { //if true the start of request is aligned
+        size_t alignedSize = size - size % AlignedBuffer::Alignment; //represents the aligned part of request
+        if (this->transfer(buffer, alignedSize, offset, false) != (long long)alignedSize) //read the aligned part, if true we failed
+            return false;
+        buffer += alignedSize; //advance the buffer
+        offset += alignedSize; //advance the offset
+        size -= alignedSize; //decrease remaining size
+    }
+    if (this->isDirect && size > 0) //if true the rest isn't aligned
+        return this->transferBounced(buffer, size, offset, false); //read the rest through the bounce buffer
+    return this->transfer(buffer, size, offset, false) == (long long)size; //return true if we read all bytes
+}
+
+
+/**
+ * @brief Method for writing exactly size bytes at given offset, returns true on success.
+ * @brief In direct mode the aligned part is written straight from buffer and the rest goes through the bounce buffer.
+ * @param unsigned char* buffer
+ * @param size_t size
+ * @param size_t offset
+ */
+bool FileIO::writeAt(const unsigned char* buffer, size_t size, size_t offset) {
+    unsigned char* source = const_cast<unsigned char*>(buffer); //transfer takes a mutable buffer, writes don't modify it
+    if (this->isDirect && offset % AlignedBuffer::Alignment == 0 && (uintptr_t)source % AlignedBuffer::Alignment == 0) { //if true the start of request is aligned
+        size_t alignedSize = size - size % AlignedBuffer::Alignment; //represents the aligned part of request
+        if (this->transfer(source, alignedSize, offset, true) != (long long)alignedSize) //write the aligned part, if true we failed
+            return false;
+        source += alignedSize; //advance the buffer
+        offset += alignedSize; //advance the offset
+        size -= alignedSize; //decrease remaining size
+    }
+    if (this->isDirect && size > 0) //if true the rest isn't aligned
+        return this->transferBounced(source, size, offset, true); //write the rest through the bounce buffer
+    return this->transfer(source, size, offset, true) == (long long)size; //return true if we wrote all bytes
+}
+
+
+/**
+ * @brief Method for switching the open file to buffered I/O after the filesystem rejected a direct request, returns true on success.
+ */
+bool FileIO::disableDirect() {
+#ifdef _WIN32
+    HANDLE bufferedHandle = ReOpenFile(this->fileHandle, GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE, FILE_FLAG_SEQUENTIAL_SCAN); //reopen the file with buffering
+    if (bufferedHandle == INVALID_HANDLE_VALUE) //if true we failed reopening the file
+        return false;
+    CloseHandle(this->fileHandle); //close the unbuffered handle
+    this->fileHandle = bufferedHandle; //use the buffered handle from now on
+#else
+#ifdef O_DIRECT
+    int flags = fcntl(this->fd, F_GETFL); //get the status flags of file
+    if (flags == -1 || fcntl(this->fd, F_SETFL, flags & ~O_DIRECT) == -1) //clear O_DIRECT, if true we failed
+        return false;
+#endif
+#endif
+    this->isDirect = false; //set isDirect to false, requests go through page cache from now on
+    return true;
+}
+
+
+/**
+ * @brief Method for setting the size of file, used to cut the padding of direct writes, returns true on success.
+ * @param size_t length
+ */
+bool FileIO::truncate(size_t length) {
+#ifdef _WIN32
+    FILE_END_OF_FILE_INFO endOfFile{}; //represents the new end of file
+    endOfFile.EndOfFile.QuadPart = (LONGLONG)length;
+    return SetFileInformationByHandle(this->fileHandle, FileEndOfFileInfo, &endOfFile, sizeof(endOfFile)) != 0; //set the end of file
+#else
+    return ftruncate(this->fd, (off_t)length) == 0; //set the size of file
+#endif
+}
+
+
+/**
+ * @brief Method for flushing written data to storage device, returns true on success.
+ */
+bool FileIO::sync() {
+#ifdef _WIN32
+    return FlushFileBuffers(this->fileHandle) != 0; //flush file buffers to device
+#else
+    return fsync(this->fd) == 0; //flush file data and metadata to device
+#endif
+}
+
+
+/**
+ * @brief Method for getting the current size of file in bytes.
+ */
+size_t FileIO::size() {
+#ifdef _WIN32
+    LARGE_INTEGER fileSize{}; //represents the file size
+    if (!GetFileSizeEx(this->fileHandle, &fileSize)) //if true we failed getting the size
+        return 0;
+    return (size_t)fileSize.QuadPart; //return the file size
+#else
+    struct stat fileStat {}; //represents the file status
+    if (fstat(this->fd, &fileStat) != 0) //if true we failed getting the status
+        return 0;
+    return (size_t)fileStat.st_size; //return the file size
+#endif
+}
+
+
+/**
+ * @brief Method for hinting the kernel that the file is streamed once, so it reads ahead and doesn't keep the pages.
+ * @brief On Windows the hint is given when opening the file with FILE_FLAG_SEQUENTIAL_SCAN.
+ */
+void FileIO::adviseSequential() {
+#ifndef _WIN32
+    FileIO::adviseStreaming(this->fd); //give the streaming hints on our file descriptor
+#endif
+}
+
+
+/**
+ * @brief Method for writing back a range and dropping its pages from the page cache, returns true on success.
+ * @brief Windows has no per-range eviction so the method does nothing there.
+ * @param size_t offset
+ * @param size_t length
+ */
+bool FileIO::release(size_t offset, size_t length) {
+#ifdef _WIN32
+    return true; //nothing to do on Windows
+#else
+    return FileIO::dropCache(this->fd, offset, length); //write back and drop the range
+#endif
+}
+
+
+/**
+ * @brief Method for closing the file.
+ */
+void FileIO::close() {
+#ifdef _WIN32
+    if (this->fileHandle != INVALID_HANDLE_VALUE) //if true we have an open file
+        CloseHandle(this->fileHandle); //close the file
+    this->fileHandle = INVALID_HANDLE_VALUE;
+#else
+    if (this->fd != -1) //if true we have an open file
+        ::close(this->fd); //close the file
+    this->fd = -1;
+#endif
+}
+
+
+/**
+ * @brief Method for checking if the file is open.
+ */
+bool FileIO::isOpen() {
+#ifdef _WIN32
+    return this->fileHandle != INVALID_HANDLE_VALUE;
+#else
+    return this->fd != -1;
+#endif
+}
+
+
+/**
+ * @brief Function for removing a file from storage, returns true on success.
+ * @param path filePath
+ */
+bool FileIO::remove(const filesystem::path& filePath) {
+#ifdef _WIN32
+    return DeleteFileW(filePath.c_str()) != 0; //delete the file
+#else
+    return unlink(filePath.c_str()) == 0; //unlink the file
+#endif
+}
+
+
+/**
+ * @brief Function for loading the metadata of file with a single status call, returns false if path isn't an existing regular file.
+ * @brief On Linux statx asks only for the fields we use, on Windows the file is opened without access rights only to query it.
+ * @param path filePath
+ * @param FileMetadata metadata
+ */
+bool FileIO::stat(const filesystem::path& filePath, FileMetadata& metadata) {
+    metadata = FileMetadata(); //clear the metadata
+#ifdef _WIN32
+    HANDLE fileHandle = CreateFileW(filePath.c_str(), 0, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, NULL, OPEN_EXISTING, 0, NULL); //open the file only for querying its information
+    if (fileHandle == INVALID_HANDLE_VALUE) //if true the file doesn't exist or is a directory
+        return false;
+    BY_HANDLE_FILE_INFORMATION fileInfo{}; //represents the information of file
+    FILE_STANDARD_INFO standardInfo{}; //represents the allocation of file
+    bool result = GetFileInformationByHandle(fileHandle, &fileInfo) && GetFileInformationByHandleEx(fileHandle, FileStandardInfo, &standardInfo, sizeof(standardInfo)); //get the information of file
+    CloseHandle(fileHandle); //close the file
+    if (!result || (fileInfo.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)) //if true we failed querying the file or it's not a regular file
+        return false;
+    metadata.size = ((size_t)fileInfo.nFileSizeHigh << 32) | fileInfo.nFileSizeLow; //set the size of file
+    metadata.allocatedSize = (size_t)standardInfo.AllocationSize.QuadPart; //set the allocated size of file
+    metadata.device = fileInfo.dwVolumeSerialNumber; //set the volume of file
+    metadata.index = ((unsigned long long)fileInfo.nFileIndexHigh << 32) | fileInfo.nFileIndexLow; //set the file index on volume
+    metadata.links = fileInfo.nNumberOfLinks; //set the amount of hard links
+    metadata.exists = true;
+    return true;
+#elif defined(__linux__)
+    struct statx fileStat {}; //represents the status of file
+    if (statx(AT_FDCWD, filePath.c_str(), AT_STATX_SYNC_AS_STAT, StatxMask, &fileStat) != 0) //if true the file doesn't exist or can't be queried
+        return false;
+    return FileIO::fromStatx(fileStat, metadata);
+#else
+    struct stat fileStat {}; //represents the status of file
+    if (::stat(filePath.c_str(), &fileStat) != 0 || !S_ISREG(fileStat.st_mode)) //if true the file doesn't exist or is not a regular file
+        return false;
+    metadata.size = (size_t)fileStat.st_size; //set the size of file
+    metadata.allocatedSize = (size_t)fileStat.st_blocks * 512; //set the allocated size of file, blocks are counted in 512 byte units
+    metadata.device = (unsigned long long)fileStat.st_dev; //set the device of file
+    metadata.index = (unsigned long long)fileStat.st_ino; //set the inode of file
+    metadata.links = (unsigned int)fileStat.st_nlink; //set the amount of hard links
+    metadata.exists = true;
+    return true;
+#endif
+}
+
+
+#ifdef __linux__
+/**
+ * @brief Function for filling the metadata of file from a statx result, returns false if file is not a regular file.
+ * @brief Shared by the direct status call and by backends that queue statx requests.
+ * @param statx fileStat
+ * @param FileMetadata metadata
+ */
+bool FileIO::fromStatx(const struct statx& fileStat, FileMetadata& metadata) {
+    if (!S_ISREG(fileStat.stx_mode)) //if true the file is not a regular file
+        return false;
+    metadata.size = (size_t)fileStat.stx_size; //set the size of file
+    metadata.allocatedSize = (size_t)fileStat.stx_blocks * 512; //set the allocated size of file, blocks are counted in 512 byte units
+    metadata.device = (unsigned long long)makedev(fileStat.stx_dev_major, fileStat.stx_dev_minor); //set the device of file
+    metadata.index = (unsigned long long)fileStat.stx_ino; //set the inode of file
+    metadata.links = (unsigned int)fileStat.stx_nlink; //set the amount of hard links
+    metadata.exists = true;
+    return true;
+}
+#endif
+
+
+#ifndef _WIN32
+/**
+ * @brief Function for giving sequential and no-reuse hints on a file descriptor, used by all backends that hold a raw descriptor.
+ * @param int fd
+ */
+void FileIO::adviseStreaming(int fd) {
+#ifdef __linux__
+    posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL); //tell the kernel to read ahead aggressively
+    posix_fadvise(fd, 0, 0, POSIX_FADV_NOREUSE); //tell the kernel the data is accessed only once
+#endif
+}
+
+
+/**
+ * @brief Function for writing back a range of file descriptor and dropping its pages from the page cache, returns true on success.
+ * @brief Dirty pages can't be dropped, so we wait for their writeback with sync_file_range before POSIX_FADV_DONTNEED.
+ * @param int fd
+ * @param size_t offset
+ * @param size_t length
+ */
+bool FileIO::dropCache(int fd, size_t offset, size_t length) {
+#ifdef __linux__
+    if (sync_file_range(fd, (off_t)offset, (off_t)length, SYNC_FILE_RANGE_WAIT_BEFORE | SYNC_FILE_RANGE_WRITE | SYNC_FILE_RANGE_WAIT_AFTER) != 0) //write back the range, if true we failed
+        return false;
+    posix_fadvise(fd, (off_t)offset, (off_t)length, POSIX_FADV_DONTNEED); //drop the clean pages of range from page cache
+#endif
+    return true;
+}
+#endif
@@ -0,0 +1,63 @@
+#ifndef _FileIO_H
+#define _FileIO_H
+#define _CRT_SECURE_NO_WARNINGS
+#include <iostream>
+#include <string.h>
+#include <vector>
+#include <filesystem>
+#include <atomic>
+#include "IOBackend.h"
+#ifdef __linux__
+#include <sys/stat.h>
+#endif
+
+using namespace std;
+
+/**
+ * @brief Class that represents an open file with positional reads and writes on a raw file descriptor.
+ * @brief Reads and writes take explicit offsets and never move a shared cursor, so multiple threads can use the same file safely.
+ * @brief In direct mode the page cache is bypassed, unaligned parts of requests go through an aligned bounce buffer padded to whole blocks.
+ */
+class FileIO : public IOFile {
+private:
+#ifdef _WIN32
+	void* fileHandle; //represents the file handle
+#else
+	int fd = -1; //represents the file descriptor
+#endif
+	atomic<bool> isDirect = false; //flag for indicating that the file is open for direct I/O
+	long long transfer(unsigned char* buffer, size_t size, size_t offset, bool write);
+	bool transferBounced(unsigned char* buffer, size_t size, size_t offset, bool write);
+	bool disableDirect();
+	bool truncate(size_t length);
+
+public:
+	static constexpr size_t BounceSize = 1024 * 1024; //maximal size of bounce buffer for unaligned direct transfers
+#ifdef __linux__
+	static constexpr unsigned StatxMask = STATX_TYPE | STATX_NLINK | STATX_INO | STATX_SIZE | STATX_BLOCKS; //fields of statx we use, the kernel may skip the others
+#endif
+	FileIO();
+	virtual ~FileIO();
+	FileIO(const FileIO&) = delete; //prevent copy
+	void operator=(const FileIO&) = delete; //prevent assignment
+	bool open(const filesystem::path& filePath, bool directIO = false);
+	bool readAt(unsigned char* buffer, size_t size, size_t offset) override;
+	bool writeAt(const unsigned char* buffer, size_t size, size_t offset) override;
+	bool sync() override;
+	size_t size() override;
+	void adviseSequential() override;
+	bool release(size_t offset, size_t length) override;
+	void close();
+	bool isOpen();
+	bool getIsDirect() { return this->isDirect; }
+	static bool remove(const filesystem::path& filePath);
+	static bool stat(const filesystem::path& filePath, FileMetadata& metadata);
+#ifdef __linux__
+	static bool fromStatx(const struct statx& fileStat, FileMetadata& metadata);
+#endif
+#ifndef _WIN32
+	static void adviseStreaming(int fd);
+	static bool dropCache(int fd, size_t offset, size_t length);
+#endif
+};
+#endif
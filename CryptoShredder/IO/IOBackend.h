@@ -0,0 +1,150 @@
+#ifndef _IOBackend_H
+#define _IOBackend_H
+#define _CRT_SECURE_NO_WARNINGS
+#include <iostream>
+#include <string.h>
+#include <vector>
+#include <memory>
+#include <filesystem>
+#include <deque>
+
+using namespace std;
+
+/**
+ * @brief Struct that represents the metadata of file, loaded once per file and shared by the file, planner and registry.
+ */
+struct FileMetadata {
+	bool exists = false; //flag for indicating that path is an existing regular file
+	size_t size = 0; //represents the size of file in bytes
+	size_t allocatedSize = 0; //represents the bytes allocated for file on device, smaller than size for sparse or compressed files
+	unsigned long long device = 0; //represents the device or volume of file
+	unsigned long long index = 0; //represents the inode or file index on device
+	unsigned int links = 0; //represents the amount of hard links of file, zero if device and index are unknown
+};
+
+
+/**
+ * @brief Struct that represents a finished request that was queued with submitRead or submitWrite.
+ */
+struct IOCompletion {
+	size_t tag = 0; //represents the tag that was given with the request
+	bool isSuccess = false; //flag for indicating that all bytes of request were transferred
+};
+
+
+/**
+ * @brief Interface that represents a file opened by an I/O backend.
+ * @brief Reads and writes take explicit offsets, readAt and writeAt may be called from multiple threads.
+ * @brief Queued requests belong to the thread that submits them, it takes their completions with complete.
+ */
+class IOFile {
+protected:
+	deque<IOCompletion> completions; //represents the finished requests of default queue that weren't taken yet
+
+public:
+	virtual bool readAt(unsigned char* buffer, size_t size, size_t offset) = 0; //read exactly size bytes from offset, returns true on success
+	virtual bool writeAt(const unsigned char* buffer, size_t size, size_t offset) = 0; //write exactly size bytes at offset, returns true on success
+	virtual bool sync() = 0; //flush written data to storage, returns true on success
+	virtual size_t size() = 0; //returns the size of file in bytes
+
+	/**
+	 * @brief Method for direct access to file contents for in-place operations, returns NULL if backend can't map the range.
+	 * @brief Pointer stays valid until the next call to map or unmap.
+	 * @param size_t offset
+	 * @param size_t length
+	 */
+	virtual unsigned char* map(size_t, size_t) { return NULL; }
+
+	/**
+	 * @brief Method for writing back and releasing the mapped range, returns true on success.
+	 */
+	virtual bool unmap() { return true; }
+
+	/**
+	 * @brief Method for hinting that the file is read and written once from start to end, default does nothing.
+	 */
+	virtual void adviseSequential() {}
+
+	/**
+	 * @brief Method for writing back a range and dropping its pages from the page cache, returns true on success.
+	 * @brief Used behind the write cursor and when a file completes so large files don't fill the cache with data nobody reads again.
+	 * @param size_t offset
+	 * @param size_t length
+	 */
+	virtual bool release(size_t, size_t) { return true; }
+
+	/**
+	 * @brief Method for queuing a read of exactly size bytes from offset, returns false if the request couldn't be queued.
+	 * @brief Buffer must stay valid until the completion of tag is taken. Default reads right away and queues the result,
+	 * @brief backends with a submission queue override it so several requests of file are in flight at once.
+	 * @param unsigned char* buffer
+	 * @param size_t size
+	 * @param size_t offset
+	 * @param size_t tag
+	 */
+	virtual bool submitRead(unsigned char* buffer, size_t size, size_t offset, size_t tag) {
+		this->completions.push_back({ tag, this->readAt(buffer, size, offset) }); //read now and queue the result
+		return true;
+	}
+
+	/**
+	 * @brief Method for queuing a write of exactly size bytes at offset, returns false if the request couldn't be queued.
+	 * @brief Buffer must stay valid until the completion of tag is taken. Default writes right away and queues the result.
+	 * @param unsigned char* buffer
+	 * @param size_t size
+	 * @param size_t offset
+	 * @param size_t tag
+	 */
+	virtual bool submitWrite(const unsigned char* buffer, size_t size, size_t offset, size_t tag) {
+		this->completions.push_back({ tag, this->writeAt(buffer, size, offset) }); //write now and queue the result
+		return true;
+	}
+
+	/**
+	 * @brief Method for waiting for the next finished request, returns false if no request is in flight or the backend can't wait.
+	 * @brief Requests may finish in any order, the tag tells which request finished.
+	 * @param IOCompletion completion
+	 */
+	virtual bool complete(IOCompletion& completion) {
+		if (this->completions.empty()) //if true there's no finished request
+			return false;
+		completion = this->completions.front(); //take the oldest finished request
+		this->completions.pop_front();
+		return true;
+	}
+
+	virtual ~IOFile() {} //dtor for IOFile
+};
+
+
+/**
+ * @brief Interface that represents an I/O backend used by the wipe and cipher engines.
+ */
+class IOBackend {
+public:
+	virtual string getName() = 0; //returns the name of backend
+	virtual unique_ptr<IOFile> open(const filesystem::path& filePath) = 0; //opens the file for reading and writing, returns NULL on failure
+	virtual bool remove(const filesystem::path& filePath) = 0; //removes the file, returns true on success
+
+	virtual bool getMetadata(const filesystem::path& filePath, FileMetadata& metadata) = 0; //loads the metadata of file without opening it, returns false if it's not an existing regular file
+
+	/**
+	 * @brief Method for loading the metadata of many files, default loads each file on its own.
+	 * @brief Backends that can queue many requests at once override it.
+	 * @param vector<path> filePaths
+	 * @param vector<FileMetadata> metadata
+	 */
+	virtual void getMetadataBatch(const vector<filesystem::path>& filePaths, vector<FileMetadata>& metadata) {
+		metadata.assign(filePaths.size(), FileMetadata()); //clear the metadata of batch
+		for (size_t i = 0; i < filePaths.size(); i++) //load the metadata of each file
+			this->getMetadata(filePaths[i], metadata[i]);
+	}
+
+	/**
+	 * @brief Method for checking if the backend can be used on this system.
+	 */
+	virtual bool isAvailable() { return true; }
+
+	virtual ~IOBackend() {} //dtor for IOBackend
+};
+#endif
@@ -0,0 +1,107 @@
+#include "MemoryBackend.h"
+
+
+/**
+ * @brief Method for reading exactly size bytes from given offset, returns true on success.
+ * @param unsigned char* buffer
+ * @param size_t size
+ * @param size_t offset
+ */
+bool MemoryFile::readAt(unsigned char* buffer, size_t size, size_t offset) {
+    if (offset + size > this->data->size()) //if true the range is outside of file
+        return false;
+    memcpy(buffer, this->data->data() + offset, size); //copy the data from memory
+    return true;
+}
+
+
+/**
+ * @brief Method for writing exactly size bytes at given offset, returns true on success.
+ * @param unsigned char* buffer
+ * @param size_t size
+ * @param size_t offset
+ */
+bool MemoryFile::writeAt(const unsigned char* buffer, size_t size, size_t offset) {
+    if (offset + size > this->data->size()) //if true the range is outside of file
+        return false;
+    memcpy(this->data->data() + offset, buffer, size); //copy the data to memory
+    return true;
+}
+
+
+/**
+ * @brief Method for direct access to file contents, returns NULL if range is outside of file.
+ * @param size_t offset
+ * @param size_t length
+ */
+unsigned char* MemoryFile::map(size_t offset, size_t length) {
+    if (length == 0 || offset + length > this->data->size()) //if true the range is outside of file
+        return NULL;
+    return this->data->data() + offset; //return pointer to requested offset
+}
+
+
+/**
+ * @brief Method for opening the file, returns NULL if file doesn't exist in memory.
+ * @param path filePath
+ */
+unique_ptr<IOFile> MemoryBackend::open(const filesystem::path& filePath) {
+    lock_guard<mutex> lock(this->filesMutex); //lock the mutex for files
+    auto fileIt = this->files.find(filePath.string()); //find the file by its path
+    if (fileIt == this->files.end()) //if true the file doesn't exist
+        return NULL;
+    return make_unique<MemoryFile>(fileIt->second); //return the open file
+}
+
+
+/**
+ * @brief Method for removing the file, returns true on success.
+ * @param path filePath
+ */
+bool MemoryBackend::remove(const filesystem::path& filePath) {
+    lock_guard<mutex> lock(this->filesMutex); //lock the mutex for files
+    return this->files.erase(filePath.string()) > 0; //remove the file if it exists
+}
+
+
+/**
+ * @brief Method for loading the metadata of file in memory, returns false if file doesn't exist.
+ * @brief Files in memory have no device or inode, so they're never merged as hard links.
+ * @param path filePath
+ * @param FileMetadata metadata
+ */
+bool MemoryBackend::getMetadata(const filesystem::path& filePath, FileMetadata& metadata) {
+    metadata = FileMetadata(); //clear the metadata
+    lock_guard<mutex> lock(this->filesMutex); //lock the mutex for files
+    auto fileIt = this->files.find(filePath.string()); //find the file by its path
+    if (fileIt == this->files.end()) //if true the file doesn't exist
+        return false;
+    metadata.size = fileIt->second->size(); //set the size of file
+    metadata.allocatedSize = metadata.size; //memory files are never sparse
+    metadata.exists = true;
+    return true;
+}
+
+
+/**
+ * @brief Method for adding a file with given contents to memory, replaces existing file with same path.
+ * @param path filePath
+ * @param vector<unsigned char> contents
+ */
+void MemoryBackend::addFile(const filesystem::path& filePath, const vector<unsigned char>& contents) {
+    lock_guard<mutex> lock(this->filesMutex); //lock the mutex for files
+    this->files[filePath.string()] = make_shared<vector<unsigned char>>(contents); //save a copy of contents
+}
+
+
+/**
+ * @brief Method for getting a copy of file contents, returns empty vector if file doesn't exist.
+ * @param path filePath
+ */
+vector<unsigned char> MemoryBackend::getFile(const filesystem::path& filePath) {
+    lock_guard<mutex> lock(this->filesMutex); //lock the mutex for files
+    auto fileIt = this->files.find(filePath.string()); //find the file by its path
+    if (fileIt == this->files.end()) //if true the file doesn't exist
+        return vector<unsigned char>();
+    return *fileIt->second; //return a copy of contents
+}
@@ -0,0 +1,44 @@
+#ifndef _MemoryBackend_H
+#define _MemoryBackend_H
+#define _CRT_SECURE_NO_WARNINGS
+#include <unordered_map>
+#include <mutex>
+#include "IOBackend.h"
+
+using namespace std;
+
+/**
+ * @brief Class that represents a file that lives in memory.
+ */
+class MemoryFile : public IOFile {
+private:
+	shared_ptr<vector<unsigned char>> data; //represents the contents of file, shared with the backend
+
+public:
+	MemoryFile(shared_ptr<vector<unsigned char>> data) : data(data) {}
+	bool readAt(unsigned char* buffer, size_t size, size_t offset) override;
+	bool writeAt(const unsigned char* buffer, size_t size, size_t offset) override;
+	bool sync() override { return true; }
+	size_t size() override { return this->data->size(); }
+	unsigned char* map(size_t offset, size_t length) override;
+};
+
+
+/**
+ * @brief I/O backend that keeps files in RAM, used for benchmarking the wipe and cipher engines without a disk.
+ * @brief Files are added with addFile and keep their size, writes never extend a file.
+ */
+class MemoryBackend : public IOBackend {
+private:
+	unordered_map<string, shared_ptr<vector<unsigned char>>> files; //represents the files in memory keyed by path
+	mutex filesMutex; //mutex for thread-safe access to files
+
+public:
+	string getName() override { return "RAM"; }
+	unique_ptr<IOFile> open(const filesystem::path& filePath) override;
+	bool remove(const filesystem::path& filePath) override;
+	bool getMetadata(const filesystem::path& filePath, FileMetadata& metadata) override;
+	void addFile(const filesystem::path& filePath, const vector<unsigned char>& contents);
+	vector<unsigned char> getFile(const filesystem::path& filePath);
+};
+#endif
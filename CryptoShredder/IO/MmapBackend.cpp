@@ -0,0 +1,259 @@
+#include "MmapBackend.h"
+#include "FileIO.h"
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+
+/**
+ * @brief Constructor of class.
+ */
+MappedFile::MappedFile() {
+#ifdef _WIN32
+    this->fileHandle = INVALID_HANDLE_VALUE; //no file is open yet
+#endif
+}
+
+
+/**
+ * @brief Destructor of class.
+ */
+MappedFile::~MappedFile() {
+    this->close(); //ensure that resources are released
+}
+
+
+/**
+ * @brief Method for opening the file for mapping, returns true on success.
+ * @brief Read-only files are opened and mapped without write access, so viewing a file never dirties its pages.
+ * @param path filePath
+ * @param bool readOnly
+ */
+bool MappedFile::open(const filesystem::path& filePath, bool readOnly) {
+    this->readOnly = readOnly; //save the access mode for mapping windows
+#ifdef _WIN32
+    if (readOnly) //if true we open the file for reading only, random access since the file isn't streamed
+        this->fileHandle = CreateFileW(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS, NULL);
+    else //else we open the file for reading and writing
+        this->fileHandle = CreateFileW(filePath.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    if (this->fileHandle == INVALID_HANDLE_VALUE) //if true we failed opening the file
+        return false;
+    LARGE_INTEGER size{}; //represents the file size
+    if (!GetFileSizeEx(this->fileHandle, &size)) //if true we failed getting the size
+        return false;
+    this->fileSize = (size_t)size.QuadPart; //save the file size
+    if (this->fileSize > 0) //empty files can't be mapped on Windows
+        this->mappingHandle = CreateFileMappingW(this->fileHandle, NULL, readOnly ? PAGE_READONLY : PAGE_READWRITE, 0, 0, NULL); //create mapping object for the whole file
+    return true;
+#else
+    this->fd = ::open(filePath.c_str(), (readOnly ? O_RDONLY : O_RDWR) | O_CLOEXEC); //open the file for reading only or for reading and writing
+    if (this->fd == -1) //if true we failed opening the file
+        return false;
+    struct stat fileStat {}; //represents the file status
+    if (fstat(this->fd, &fileStat) != 0) //if true we failed getting the size
+        return false;
+    this->fileSize = (size_t)fileStat.st_size; //save the file size
+    return true;
+#endif
+}
+
+
+/**
+ * @brief Method for mapping the window that contains given range, returns pointer to offset or NULL on failure.
+ * @brief Current window is reused if it covers the range, otherwise it's written back and a new window is mapped.
+ * @param size_t offset
+ * @param size_t length
+ */
+unsigned char* MappedFile::map(size_t offset, size_t length) {
+    if (length == 0 || offset + length > this->fileSize) //if true the range is outside of file
+        return NULL;
+    if (this->view != NULL && offset >= this->viewOffset && offset + length <= this->viewOffset + this->viewLength) //if true current window covers the range
+        return this->view + (offset - this->viewOffset);
+    if (!this->unmap()) //write back the current window, if true we failed
+        return NULL;
+
+    size_t windowOffset = offset - (offset % MappedFile::WindowAlignment); //align window offset down for the mapping
+    size_t windowLength = min(this->fileSize - windowOffset, max(MappedFile::WindowSize, offset + length - windowOffset)); //map at least WindowSize bytes
+#ifdef _WIN32
+    if (this->mappingHandle == NULL) //if true the file can't be mapped
+        return NULL;
+    void* address = MapViewOfFile(this->mappingHandle, this->readOnly ? FILE_MAP_READ : FILE_MAP_READ | FILE_MAP_WRITE, (DWORD)((unsigned long long)windowOffset >> 32), (DWORD)(windowOffset & 0xFFFFFFFF), windowLength); //map the window of file
+    if (address == NULL) //if true we failed mapping the window
+        return NULL;
+#else
+    void* address = mmap(NULL, windowLength, this->readOnly ? PROT_READ : PROT_READ | PROT_WRITE, MAP_SHARED, this->fd, (off_t)windowOffset); //map the window of file
+    if (address == MAP_FAILED) //if true we failed mapping the window
+        return NULL;
+    if (!this->readOnly) //read-only files are accessed at random, only streamed files get read ahead
+        madvise(address, windowLength, MADV_SEQUENTIAL); //tell the kernel we access the window sequentially so it reads ahead
+#endif
+    this->view = (unsigned char*)address; //save the mapped window
+    this->viewOffset = windowOffset; //save the offset of mapped window
+    this->viewLength = windowLength; //save the length of mapped window
+    return this->view + (offset - windowOffset); //return pointer to requested offset
+}
+
+
+/**
+ * @brief Method for writing back the mapped window to storage and unmapping it, returns true on success.
+ */
+bool MappedFile::unmap() {
+    bool result = true; //represents the result of write back
+    if (this->view != NULL) { //if true we have a mapped window
+#ifdef _WIN32
+        if (!this->readOnly) //read-only windows have no dirty pages
+            result = FlushViewOfFile(this->view, this->viewLength) != 0; //write back the dirty pages of window
+        UnmapViewOfFile(this->view); //unmap the window
+#else
+        if (!this->readOnly) //read-only windows have no dirty pages
+            result = msync(this->view, this->viewLength, MS_SYNC) == 0; //write back the dirty pages of window
+        munmap(this->view, this->viewLength); //unmap the window
+#endif
+        this->view = NULL; //set view back to NULL
+        this->viewOffset = 0; //set viewOffset back to zero
+        this->viewLength = 0; //set viewLength back to zero
+    }
+    return result; //return the result
+}
+
+
+/**
+ * @brief Method for reading exactly size bytes from given offset through the mapped window, returns true on success.
+ * @param unsigned char* buffer
+ * @param size_t size
+ * @param size_t offset
+ */
+bool MappedFile::readAt(unsigned char* buffer, size_t size, size_t offset) {
+    lock_guard<recursive_mutex> lock(this->viewMutex); //lock the mutex so no other thread switches the window
+    unsigned char* source = this->map(offset, size); //map the window that contains the range
+    if (source == NULL) //if true we failed mapping the range
+        return false;
+    memcpy(buffer, source, size); //copy the data from mapped pages
+    return true;
+}
+
+
+/**
+ * @brief Method for writing exactly size bytes at given offset through the mapped window, returns true on success.
+ * @param unsigned char* buffer
+ * @param size_t size
+ * @param size_t offset
+ */
+bool MappedFile::writeAt(const unsigned char* buffer, size_t size, size_t offset) {
+    lock_guard<recursive_mutex> lock(this->viewMutex); //lock the mutex so no other thread switches the window
+    unsigned char* destination = this->map(offset, size); //map the window that contains the range
+    if (destination == NULL) //if true we failed mapping the range
+        return false;
+    memcpy(destination, buffer, size); //copy the data to mapped pages
+    return true;
+}
+
+
+/**
+ * @brief Method for flushing the mapped window and file to storage, returns true on success.
+ */
+bool MappedFile::sync() {
+    lock_guard<recursive_mutex> lock(this->viewMutex); //lock the mutex so no other thread switches the window
+    bool result = true; //represents the result of flush
+#ifdef _WIN32
+    if (this->view != NULL) //if true we have a mapped window
+        result = FlushViewOfFile(this->view, this->viewLength) != 0; //write back the dirty pages of window
+    return FlushFileBuffers(this->fileHandle) != 0 && result; //flush file buffers to device
+#else
+    if (this->view != NULL) //if true we have a mapped window
+        result = msync(this->view, this->viewLength, MS_SYNC) == 0; //write back the dirty pages of window
+    return fsync(this->fd) == 0 && result; //flush file data and metadata to device
+#endif
+}
+
+
+/**
+ * @brief Method for hinting the kernel that the file is streamed once, windows get MADV_SEQUENTIAL when mapped.
+ */
+void MappedFile::adviseSequential() {
+#ifndef _WIN32
+    FileIO::adviseStreaming(this->fd); //give the streaming hints on our file descriptor
+#endif
+}
+
+
+/**
+ * @brief Method for writing back a range and dropping its pages from the page cache, returns true on success.
+ * @brief Pages that are still mapped can't be evicted, so the part of range inside current window is written back and unmapped from our page tables first.
+ * @param size_t offset
+ * @param size_t length
+ */
+bool MappedFile::release(size_t offset, size_t length) {
+#ifdef _WIN32
+    return true; //Windows has no per-range eviction
+#else
+    lock_guard<recursive_mutex> lock(this->viewMutex); //lock the mutex so no other thread switches the window
+    size_t rangeStart = max(offset, this->viewOffset); //represents the start of range inside current window
+    size_t rangeEnd = min(offset + length, this->viewOffset + this->viewLength); //represents the end of range inside current window
+    if (this->view != NULL && rangeStart < rangeEnd) { //if true part of range is mapped
+        size_t pageSize = (size_t)sysconf(_SC_PAGESIZE); //represents the page size, msync and madvise need page aligned addresses
+        rangeStart -= (rangeStart - this->viewOffset) % pageSize; //align start down to page inside the window
+        if (msync(this->view + (rangeStart - this->viewOffset), rangeEnd - rangeStart, MS_SYNC) != 0) //write back the dirty pages, if true we failed
+            return false;
+        madvise(this->view + (rangeStart - this->viewOffset), rangeEnd - rangeStart, MADV_DONTNEED); //drop the pages from our mapping, shared mapping keeps the data in file
+    }
+    return FileIO::dropCache(this->fd, offset, length); //write back and drop the range from page cache
+#endif
+}
+
+
+/**
+ * @brief Method for closing the file and releasing mapping resources.
+ */
+void MappedFile::close() {
+    this->unmap(); //unmap current window if any
+#ifdef _WIN32
+    if (this->mappingHandle != NULL) //if true we have a mapping object
+        CloseHandle(this->mappingHandle); //close the mapping object
+    if (this->fileHandle != INVALID_HANDLE_VALUE) //if true we have an open file
+        CloseHandle(this->fileHandle); //close the file
+    this->mappingHandle = NULL;
+    this->fileHandle = INVALID_HANDLE_VALUE;
+#else
+    if (this->fd != -1) //if true we have an open file
+        ::close(this->fd); //close the file
+    this->fd = -1;
+#endif
+}
+
+
+/**
+ * @brief Method for opening the file, returns NULL on failure.
+ * @param path filePath
+ */
+unique_ptr<IOFile> MmapBackend::open(const filesystem::path& filePath) {
+    unique_ptr<MappedFile> file = make_unique<MappedFile>(); //create the file object
+    if (!file->open(filePath)) //if true we failed opening the file
+        return NULL;
+    return file; //return the open file
+}
+
+
+/**
+ * @brief Method for removing the file, returns true on success.
+ * @param path filePath
+ */
+bool MmapBackend::remove(const filesystem::path& filePath) {
+    return FileIO::remove(filePath); //remove the file from storage
+}
+
+
+/**
+ * @brief Method for loading the metadata of file with a single status call.
+ * @param path filePath
+ * @param FileMetadata metadata
+ */
+bool MmapBackend::getMetadata(const filesystem::path& filePath, FileMetadata& metadata) {
+    return FileIO::stat(filePath, metadata); //load the metadata from storage
+}
@@ -0,0 +1,59 @@
+#ifndef _MmapBackend_H
+#define _MmapBackend_H
+#define _CRT_SECURE_NO_WARNINGS
+#include <mutex>
+#include "IOBackend.h"
+
+using namespace std;
+
+/**
+ * @brief Class that represents a file accessed through memory-mapped windows.
+ * @brief Windows are mapped on demand, map gives in-place access to the pages so no user-space copy is needed.
+ */
+class MappedFile : public IOFile {
+private:
+#ifdef _WIN32
+	void* fileHandle; //represents the file handle
+	void* mappingHandle = NULL; //represents the file mapping handle
+#else
+	int fd = -1; //represents the file descriptor
+#endif
+	size_t fileSize = 0; //represents the size of file
+	unsigned char* view = NULL; //represents the current mapped window
+	size_t viewOffset = 0; //represents the offset of current mapped window in file
+	size_t viewLength = 0; //represents the length of current mapped window
+	recursive_mutex viewMutex; //mutex for thread-safe window switching in readAt and writeAt
+	bool readOnly = false; //flag for indicating that file was opened for reading only, windows are mapped without write access
+
+public:
+	static constexpr size_t WindowSize = 256 * 1024 * 1024; //size of each mapped window
+	static constexpr size_t WindowAlignment = 64 * 1024; //alignment of window offsets, allocation granularity on Windows and multiple of page size
+	MappedFile();
+	virtual ~MappedFile();
+	MappedFile(const MappedFile&) = delete; //prevent copy
+	void operator=(const MappedFile&) = delete; //prevent assignment
+	bool open(const filesystem::path& filePath, bool readOnly=false);
+	bool readAt(unsigned char* buffer, size_t size, size_t offset) override;
+	bool writeAt(const unsigned char* buffer, size_t size, size_t offset) override;
+	bool sync() override;
+	size_t size() override { return this->fileSize; }
+	unsigned char* map(size_t offset, size_t length) override;
+	bool unmap() override;
+	void adviseSequential() override;
+	bool release(size_t offset, size_t length) override;
+	bool isReadOnly() { return this->readOnly; }
+	void close();
+};
+
+
+/**
+ * @brief I/O backend that maps files into memory in windows of several hundred MB.
+ */
+class MmapBackend : public IOBackend {
+public:
+	string getName() override { return "mmap"; }
+	unique_ptr<IOFile> open(const filesystem::path& filePath) override;
+	bool remove(const filesystem::path& filePath) override;
+	bool getMetadata(const filesystem::path& filePath, FileMetadata& metadata) override;
+};
+#endif
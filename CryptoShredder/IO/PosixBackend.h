@@ -0,0 +1,50 @@
+#ifndef _PosixBackend_H
+#define _PosixBackend_H
+#define _CRT_SECURE_NO_WARNINGS
+#include "IOBackend.h"
+#include "FileIO.h"
+
+using namespace std;
+
+/**
+ * @brief I/O backend with positional pread/pwrite on raw file descriptors (ReadFile/WriteFile with offsets on Windows).
+ * @brief With directIO files are opened with O_DIRECT (FILE_FLAG_NO_BUFFERING on Windows) so data goes to the device without the page cache.
+ */
+class PosixBackend : public IOBackend {
+private:
+	bool directIO; //flag for opening files with direct I/O
+
+public:
+	PosixBackend(bool directIO = false) : directIO(directIO) {}
+	string getName() override { return this->directIO ? "POSIX direct" : "POSIX"; }
+	bool getDirectIO() { return this->directIO; }
+
+	/**
+	 * @brief Method for opening the file, returns NULL on failure.
+	 * @param path filePath
+	 */
+	unique_ptr<IOFile> open(const filesystem::path& filePath) override {
+		unique_ptr<FileIO> file = make_unique<FileIO>(); //create the file object
+		if (!file->open(filePath, this->directIO)) //if true we failed opening the file, falls back to buffered I/O if filesystem rejects direct I/O
+			return NULL;
+		return file; //return the open file
+	}
+
+	/**
+	 * @brief Method for removing the file, returns true on success.
+	 * @param path filePath
+	 */
+	bool remove(const filesystem::path& filePath) override {
+		return FileIO::remove(filePath); //remove the file from storage
+	}
+
+	/**
+	 * @brief Method for loading the metadata of file with a single status call.
+	 * @param path filePath
+	 * @param FileMetadata metadata
+	 */
+	bool getMetadata(const filesystem::path& filePath, FileMetadata& metadata) override {
+		return FileIO::stat(filePath, metadata); //load the metadata from storage
+	}
+};
+#endif
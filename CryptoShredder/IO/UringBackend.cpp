@@ -0,0 +1,351 @@
+#include "UringBackend.h"
+#include "FileIO.h"
+#if defined(__linux__) && __has_include(<liburing.h>)
+#define CRYPTOSHREDDER_IO_URING
+#include <liburing.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#include <sys/stat.h>
+#include <mutex>
+#include <list>
+#include <atomic>
+#endif
+
+
+#ifdef CRYPTOSHREDDER_IO_URING
+/**
+ * @brief Class that represents a file with its own io_uring instance.
+ * @brief Each request has its own entry, so several reads and writes of file are in flight at once. Submissions and completions
+ * @brief have separate mutexes, so queuing a request never waits for a thread that waits for completions.
+ */
+class UringFile : public IOFile {
+private:
+    /**
+     * @brief Struct that represents a request in flight, its address is the user data of its entry.
+     */
+    struct UringRequest {
+        unsigned char* buffer = NULL; //represents the buffer of bytes that are left
+        size_t size = 0; //represents the amount of bytes that are left
+        size_t offset = 0; //represents the offset of bytes that are left
+        size_t tag = 0; //represents the tag of request, returned with its completion
+        int operation = IORING_OP_READ; //represents the operation of request, read, write or fsync
+        bool isSync = false; //flag for indicating that a thread waits for this request in readAt, writeAt or sync
+        bool isDone = false; //flag for indicating that request finished
+        bool isSuccess = false; //flag for indicating that all bytes of request were transferred
+    };
+
+    int fd = -1; //represents the file descriptor
+    io_uring ring{}; //represents the submission and completion queues
+    bool isRingReady = false; //flag for indicating that ring was initialized
+    bool isBroken = false; //flag for indicating that the ring failed, entries may still be in kernel so requests are kept until the file is closed
+    list<UringRequest> requests; //represents the requests in flight, a list so their addresses stay valid
+    atomic<size_t> queuedRequests = 0; //represents the amount of requests from submitRead and submitWrite that didn't finish yet
+    mutex submitMutex; //mutex for the submission queue and requests
+    mutex completeMutex; //mutex for the completion queue and completions
+
+    /**
+     * @brief Method for queuing an entry for the bytes of request that are left, returns true on success. Caller holds submitMutex.
+     * @param UringRequest* request
+     */
+    bool submit(UringRequest* request) {
+        if (this->isBroken) //if true we can't use the ring
+            return false;
+        io_uring_sqe* sqe = io_uring_get_sqe(&this->ring); //get a free submission entry
+        if (sqe == NULL) //if true the queue is full
+            return false;
+        unsigned length = (unsigned)min(request->size, (size_t)0x40000000); //limit each entry to 1GB
+        if (request->operation == IORING_OP_WRITE)
+            io_uring_prep_write(sqe, this->fd, request->buffer, length, (unsigned long long)request->offset); //prepare positional write
+        else if (request->operation == IORING_OP_READ)
+            io_uring_prep_read(sqe, this->fd, request->buffer, length, (unsigned long long)request->offset); //prepare positional read
+        else
+            io_uring_prep_fsync(sqe, this->fd, 0); //prepare fsync of data and metadata
+        io_uring_sqe_set_data(sqe, request); //the completion points to its request
+        int submitted = 0; //represents the amount of submitted entries
+        do {
+            submitted = io_uring_submit(&this->ring); //submit the entry
+        } while (submitted == -EINTR || submitted == -EAGAIN); //retry if we got interrupted or kernel was short on resources
+        if (submitted <= 0) //if true the ring failed, the entry stays in the queue
+            this->isBroken = true;
+        return submitted > 0;
+    }
+
+    /**
+     * @brief Method for creating a request and queuing it, returns NULL on failure.
+     * @param UringRequest request
+     */
+    UringRequest* enqueue(const UringRequest& request) {
+        lock_guard<mutex> lock(this->submitMutex); //lock the mutex for submissions
+        this->requests.push_back(request); //save the request, its address is the user data of entry
+        UringRequest* queued = &this->requests.back(); //represents the saved request
+        if (this->submit(queued)) //if true the request is in flight
+            return queued;
+        if (!this->isBroken) //if true the entry wasn't queued, otherwise kernel may still read it
+            this->requests.pop_back();
+        return NULL;
+    }
+
+    /**
+     * @brief Method for removing a finished request.
+     * @param UringRequest* request
+     */
+    void forget(UringRequest* request) {
+        lock_guard<mutex> lock(this->submitMutex); //lock the mutex for requests
+        if (!this->isBroken) //if true no entry of ring points to the request anymore
+            this->requests.remove_if([request](const UringRequest& queued) { return &queued == request; });
+    }
+
+    /**
+     * @brief Method for waiting for one completion, returns false if the ring can't wait. Caller holds completeMutex.
+     * @brief Short transfers are queued again for the bytes that are left, a finished request from submitRead or submitWrite
+     * @brief is added to completions and a finished request of readAt, writeAt or sync is left for the thread that waits for it.
+     */
+    bool reap() {
+        io_uring_cqe* cqe = NULL; //represents the completion
+        int waitResult = 0; //represents the result of wait
+        do {
+            waitResult = io_uring_wait_cqe(&this->ring, &cqe); //wait for next completion
+        } while (waitResult == -EINTR); //retry if we got interrupted
+        if (waitResult < 0) //if true we can't wait for completions
+            return false;
+        UringRequest* request = (UringRequest*)io_uring_cqe_get_data(cqe); //get the request of completion
+        int result = cqe->res; //save the result of entry
+        io_uring_cqe_seen(&this->ring, cqe); //mark the completion as consumed
+        if (request->operation != IORING_OP_FSYNC && result > 0) { //if true the entry transferred some bytes
+            request->buffer += result; //advance the buffer
+            request->offset += result; //advance the offset
+            request->size -= result; //decrease remaining size
+        }
+        bool isRetry = result == -EINTR || result == -EAGAIN || (request->operation != IORING_OP_FSYNC && result > 0 && request->size > 0); //represents that request isn't done, entry was interrupted or transfer was short
+        if (isRetry) { //if true we queue the bytes that are left
+            lock_guard<mutex> lock(this->submitMutex); //lock the mutex for submissions
+            if (this->submit(request)) //if true the request is in flight again
+                return true;
+        }
+        request->isDone = true; //the request finished
+        request->isSuccess = !isRetry && (request->operation == IORING_OP_FSYNC ? result == 0 : result > 0); //a read that reaches end of file or a write that writes nothing fails
+        if (!request->isSync) { //if true the request was queued with submitRead or submitWrite
+            this->completions.push_back({ request->tag, request->isSuccess }); //pass the completion to complete
+            this->queuedRequests--; //decrease the amount of queued requests
+            this->forget(request); //remove the request
+        }
+        return true;
+    }
+
+    /**
+     * @brief Method for running one request and waiting for it, returns true if all its bytes were transferred.
+     * @brief Completions of queued requests that finish meanwhile are kept for complete.
+     * @param unsigned char* buffer
+     * @param size_t size
+     * @param size_t offset
+     * @param int operation
+     */
+    bool transfer(unsigned char* buffer, size_t size, size_t offset, int operation) {
+        if (size == 0 && operation != IORING_OP_FSYNC) //if true there's nothing to transfer
+            return true;
+        UringRequest* request = this->enqueue({ buffer, size, offset, 0, operation, true }); //queue the request
+        if (request == NULL) //if true we failed queuing the request
+            return false;
+        lock_guard<mutex> lock(this->completeMutex); //lock the mutex for completions
+        while (!request->isDone) //wait until our request finished, another thread may have reaped it
+            if (!this->reap()) //if true we can't wait for completions
+                return false;
+        bool isSuccess = request->isSuccess; //save the result of request
+        this->forget(request); //remove the request
+        return isSuccess;
+    }
+
+public:
+    /**
+     * @brief Method for opening the file and creating its ring, returns true on success.
+     * @param path filePath
+     */
+    bool open(const filesystem::path& filePath) {
+        this->fd = ::open(filePath.c_str(), O_RDWR | O_CLOEXEC); //open the file for reading and writing
+        if (this->fd == -1) //if true we failed opening the file
+            return false;
+        this->isRingReady = io_uring_queue_init(UringBackend::QueueDepth, &this->ring, 0) == 0; //create the ring
+        return this->isRingReady;
+    }
+
+    bool readAt(unsigned char* buffer, size_t size, size_t offset) override {
+        return this->transfer(buffer, size, offset, IORING_OP_READ); //read through the ring
+    }
+
+    bool writeAt(const unsigned char* buffer, size_t size, size_t offset) override {
+        return this->transfer(const_cast<unsigned char*>(buffer), size, offset, IORING_OP_WRITE); //write through the ring, buffer isn't modified
+    }
+
+    bool sync() override {
+        return this->transfer(NULL, 0, 0, IORING_OP_FSYNC); //flush through the ring
+    }
+
+    bool submitRead(unsigned char* buffer, size_t size, size_t offset, size_t tag) override {
+        this->queuedRequests++; //count the request before it can finish
+        if (this->enqueue({ buffer, size, offset, tag, IORING_OP_READ, false }) != NULL) //if true the read is in flight
+            return true;
+        this->queuedRequests--; //the request wasn't queued
+        return false;
+    }
+
+    bool submitWrite(const unsigned char* buffer, size_t size, size_t offset, size_t tag) override {
+        this->queuedRequests++; //count the request before it can finish
+        if (this->enqueue({ const_cast<unsigned char*>(buffer), size, offset, tag, IORING_OP_WRITE, false }) != NULL) //if true the write is in flight, buffer isn't modified
+            return true;
+        this->queuedRequests--; //the request wasn't queued
+        return false;
+    }
+
+    bool complete(IOCompletion& completion) override {
+        lock_guard<mutex> lock(this->completeMutex); //lock the mutex for completions
+        while (this->completions.empty()) { //wait until a queued request finished
+            if (this->queuedRequests == 0 || !this->reap()) //if true no request is in flight or we can't wait for completions
+                return false;
+        }
+        completion = this->completions.front(); //take the oldest finished request
+        this->completions.pop_front();
+        return true;
+    }
+
+    size_t size() override {
+        struct stat fileStat {}; //represents the file status
+        if (fstat(this->fd, &fileStat) != 0) //if true we failed getting the status
+            return 0;
+        return (size_t)fileStat.st_size; //return the file size
+    }
+
+    void adviseSequential() override {
+        FileIO::adviseStreaming(this->fd); //give the streaming hints on our file descriptor
+    }
+
+    bool release(size_t offset, size_t length) override {
+        return FileIO::dropCache(this->fd, offset, length); //write back and drop the range from page cache
+    }
+
+    ~UringFile() {
+        if (this->isRingReady) //if true we created the ring
+            io_uring_queue_exit(&this->ring); //release the ring
+        if (this->fd != -1) //if true we have an open file
+            ::close(this->fd); //close the file
+    }
+};
+#endif
+
+
+/**
+ * @brief Method for opening the file, returns NULL on failure or if io_uring isn't available.
+ * @param path filePath
+ */
+#ifdef CRYPTOSHREDDER_IO_URING
+unique_ptr<IOFile> UringBackend::open(const filesystem::path& filePath) {
+    unique_ptr<UringFile> file = make_unique<UringFile>(); //create the file object
+    if (!file->open(filePath)) //if true we failed opening the file or creating its ring
+        return NULL;
+    return file; //return the open file
+}
+#else
+unique_ptr<IOFile> UringBackend::open(const filesystem::path&) {
+    return NULL; //io_uring isn't available in this build
+}
+#endif
+
+
+/**
+ * @brief Method for removing the file, returns true on success.
+ * @param path filePath
+ */
+bool UringBackend::remove(const filesystem::path& filePath) {
+    return FileIO::remove(filePath); //remove the file from storage
+}
+
+
+/**
+ * @brief Method for loading the metadata of file with a single status call.
+ * @param path filePath
+ * @param FileMetadata metadata
+ */
+bool UringBackend::getMetadata(const filesystem::path& filePath, FileMetadata& metadata) {
+    return FileIO::stat(filePath, metadata); //load the metadata from storage
+}
+
+
+/**
+ * @brief Method for loading the metadata of many files, statx requests are queued in batches of StatxDepth and submitted together.
+ * @brief Kernels without statx in io_uring and paths that weren't submitted or reaped fall back to a status call per file.
+ * @param vector<path> filePaths
+ * @param vector<FileMetadata> metadata
+ */
+void UringBackend::getMetadataBatch(const vector<filesystem::path>& filePaths, vector<FileMetadata>& metadata) {
+#ifdef CRYPTOSHREDDER_IO_URING
+    io_uring ring{}; //represents the ring of batch
+    if (io_uring_queue_init(StatxDepth, &ring, 0) != 0) { //if true we can't create a ring, we load each file on its own
+        IOBackend::getMetadataBatch(filePaths, metadata);
+        return;
+    }
+    metadata.assign(filePaths.size(), FileMetadata()); //clear the metadata of batch
+    struct statx* fileStats = new struct statx[StatxDepth]; //represents the results of queued requests
+    vector<bool> isReaped(StatxDepth); //represents the requests of current batch whose completion was taken
+    bool isBroken = false; //flag for indicating that we can't wait for completions, requests of batch may still be running
+    size_t start = 0; //represents the index of first path of current batch
+    while (start < filePaths.size()) { //iterate over the batches of paths
+        size_t count = min((size_t)StatxDepth, filePaths.size() - start); //represents the amount of paths in batch
+        for (size_t i = 0; i < count; i++) { //queue a statx request for each path
+            io_uring_sqe* sqe = io_uring_get_sqe(&ring); //get a free submission entry, ring has an entry for each path of batch
+            io_uring_prep_statx(sqe, AT_FDCWD, filePaths[start + i].c_str(), AT_STATX_SYNC_AS_STAT, FileIO::StatxMask, &fileStats[i]);
+            io_uring_sqe_set_data(sqe, (void*)(uintptr_t)i); //save the index of path in batch
+            isReaped[i] = false;
+        }
+        int submitted = io_uring_submit(&ring); //submit the whole batch with one call
+        for (int i = 0; i < submitted; i++) { //wait for each submitted request
+            io_uring_cqe* cqe = NULL; //represents the completion of request
+            int waitResult = 0; //represents the result of wait
+            do {
+                waitResult = io_uring_wait_cqe(&ring, &cqe); //wait for next completion
+            } while (waitResult == -EINTR); //retry if we got interrupted
+            if (waitResult < 0) { //if true we can't wait for completions
+                isBroken = true;
+                break;
+            }
+            size_t index = (size_t)(uintptr_t)io_uring_cqe_get_data(cqe); //get the index of path in batch
+            if (cqe->res == 0) //if true statx succeeded
+                FileIO::fromStatx(fileStats[index], metadata[start + index]);
+            else if (cqe->res == -EINVAL || cqe->res == -EOPNOTSUPP) //if true kernel can't run statx in io_uring
+                FileIO::stat(filePaths[start + index], metadata[start + index]);
+            isReaped[index] = true; //the result of path was taken
+            io_uring_cqe_seen(&ring, cqe); //mark the completion as consumed
+        }
+        if (isBroken || submitted != (int)count) { //if true the ring failed, paths of batch that weren't reaped are loaded on their own
+            for (size_t i = 0; i < count; i++)
+                if (!isReaped[i])
+                    FileIO::stat(filePaths[start + i], metadata[start + i]);
+            start += count; //the batch is done
+            break; //the paths that are left are loaded on their own
+        }
+        start += count; //advance to next batch
+    }
+    io_uring_queue_exit(&ring); //release the ring
+    if (!isBroken) //if true every submitted request was reaped, otherwise they may still write their results after the ring is released
+        delete[] fileStats; //release the results
+    for (; start < filePaths.size(); start++) //load the paths that weren't submitted
+        FileIO::stat(filePaths[start], metadata[start]);
+#else
+    IOBackend::getMetadataBatch(filePaths, metadata); //io_uring isn't available in this build
+#endif
+}
+
+
+/**
+ * @brief Method for checking if io_uring can be used, kernel may not support it even if liburing is available.
+ */
+bool UringBackend::isAvailable() {
+#ifdef CRYPTOSHREDDER_IO_URING
+    io_uring ring{}; //represents a test ring
+    if (io_uring_queue_init(1, &ring, 0) != 0) //if true the kernel doesn't support io_uring
+        return false;
+    io_uring_queue_exit(&ring); //release the test ring
+    return true;
+#else
+    return false;
+#endif
+}
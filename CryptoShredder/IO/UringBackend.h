@@ -0,0 +1,24 @@
+#ifndef _UringBackend_H
+#define _UringBackend_H
+#define _CRT_SECURE_NO_WARNINGS
+#include "IOBackend.h"
+
+using namespace std;
+
+/**
+ * @brief I/O backend that submits reads, writes and syncs through io_uring, queued requests of each file are in flight together.
+ * @brief Metadata of many files is loaded with batches of statx requests, so a whole batch costs one submission.
+ * @brief Available only on Linux builds with liburing (link with -luring), isAvailable returns false elsewhere.
+ */
+class UringBackend : public IOBackend {
+public:
+	static constexpr unsigned QueueDepth = 8; //amount of entries in each file's submission queue, more than the buffers of cipher pipeline so its requests are all in flight
+	static constexpr unsigned StatxDepth = 64; //amount of statx requests queued at once when loading metadata
+	string getName() override { return "io_uring"; }
+	unique_ptr<IOFile> open(const filesystem::path& filePath) override;
+	bool remove(const filesystem::path& filePath) override;
+	bool getMetadata(const filesystem::path& filePath, FileMetadata& metadata) override;
+	void getMetadataBatch(const vector<filesystem::path>& filePaths, vector<FileMetadata>& metadata) override;
+	bool isAvailable() override;
+};
+#endif
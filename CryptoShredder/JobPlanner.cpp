@@ -0,0 +1,116 @@
+#include "JobPlanner.h"
+#include <algorithm>
+
+
+/**
+ * @brief Method for merging files that point to the same inode, first file is processed and the others become its aliases.
+ * @brief The device and inode come from the metadata loaded with each file, so planning makes no system calls.
+ * @brief Returns the files that will be processed with their device, zero if device is unknown.
+ * @param vector<File*> files
+ */
+vector<pair<File*, unsigned long long>> JobPlanner::deduplicate(const vector<File*>& files) {
+	vector<pair<File*, unsigned long long>> uniqueFiles; //represents the files that will be processed
+	for (File* file : files) {
+		const FileMetadata& metadata = file->getMetadata(); //represents the metadata of file, loaded when file was created
+		if (metadata.links > 0) { //if true we know the identity of file
+			auto [identityIt, isNew] = this->identities.try_emplace(FileIdentity{ metadata.device, metadata.index }, file); //add the file if its identity is new
+			if (!isNew) { //if true the file is a duplicate of a file we already process
+				this->aliases[identityIt->second].push_back(file); //add the file as alias of processed file
+				continue;
+			}
+		}
+		uniqueFiles.push_back({ file, metadata.device }); //add the file to processed files
+	}
+	return uniqueFiles;
+}
+
+
+/**
+ * @brief Method for adding a file to the tasks, a large file gets its own task and a small file joins the batch of its device.
+ * @param File* file
+ * @param unsigned long long device
+ * @param vector<PlannedTask> readyTasks
+ */
+void JobPlanner::addFile(File* file, unsigned long long device, vector<PlannedTask>& readyTasks) {
+	if (file->getLength() > this->batchThreshold) { //if true the file gets its own task
+		readyTasks.push_back({ { file }, file->getLength(), device });
+		return;
+	}
+	PlannedTask& batch = this->openBatches[device]; //represents the batch of device
+	if (!batch.files.empty() && (batch.totalSize + file->getLength() > this->batchSize || batch.files.size() >= this->batchMaxFiles)) { //if true the batch is full
+		readyTasks.push_back(move(batch)); //add the batch as a task
+		batch = PlannedTask(); //start a new batch
+	}
+	batch.files.push_back(file); //add the file to batch
+	batch.totalSize += file->getLength(); //add the size of file to batch
+	batch.device = device; //set the device of batch
+}
+
+
+/**
+ * @brief Method for planning the tasks of job from given files.
+ * @param vector<File*> files
+ */
+void JobPlanner::plan(const vector<File*>& files) {
+	this->tasks.clear(); //clear previous plan
+	this->aliases.clear(); //clear previous aliases
+	this->identities.clear(); //clear previous identities
+	this->openBatches.clear(); //clear previous batches
+	vector<pair<File*, unsigned long long>> uniqueFiles = this->deduplicate(files); //represents the files that will be processed
+
+	//order the files from largest to smallest, so the largest files start first and small files fill the idle workers at the end
+	stable_sort(uniqueFiles.begin(), uniqueFiles.end(), [](const auto& first, const auto& second) { return first.first->getLength() > second.first->getLength(); });
+
+	//create a task for each large file and bundle small files of same device into batches
+	for (const auto& [file, device] : uniqueFiles)
+		this->addFile(file, device, this->tasks);
+	this->flush(this->tasks); //add the batches that are left
+	stable_sort(this->tasks.begin(), this->tasks.end(), [](const PlannedTask& first, const PlannedTask& second) { return first.totalSize > second.totalSize; }); //order the tasks from largest to smallest
+}
+
+
+/**
+ * @brief Method for planning files that are discovered while the job runs, adds the tasks that are ready to given vector.
+ * @brief Files are deduplicated against all files planned before, small files wait in their batch until it's full or flushed.
+ * @param vector<File*> files
+ * @param vector<PlannedTask> readyTasks
+ */
+void JobPlanner::stream(const vector<File*>& files, vector<PlannedTask>& readyTasks) {
+	for (const auto& [file, device] : this->deduplicate(files)) //iterate over the new unique files
+		this->addFile(file, device, readyTasks);
+}
+
+
+/**
+ * @brief Method for adding the batches that aren't full to given vector, called when no more files will be planned.
+ * @param vector<PlannedTask> readyTasks
+ */
+void JobPlanner::flush(vector<PlannedTask>& readyTasks) {
+	for (auto& [device, batch] : this->openBatches) { //iterate over the batches that are left
+		if (!batch.files.empty()) //if true the batch has files
+			readyTasks.push_back(move(batch)); //add the batch as a task
+	}
+	this->openBatches.clear(); //all batches were added
+}
+
+
+/**
+ * @brief Method for getting the aliases of a processed file, returns empty vector if file has no aliases.
+ * @param File* file
+ */
+const vector<File*>& JobPlanner::getAliases(File* file) {
+	static const vector<File*> noAliases; //represents empty list of aliases
+	auto aliasIt = this->aliases.find(file); //find the aliases of file
+	return (aliasIt != this->aliases.end()) ? aliasIt->second : noAliases;
+}
+
+
+/**
+ * @brief Method for getting the total size of planned tasks, aliases are not counted since they're not processed.
+ */
+size_t JobPlanner::getTotalSize() {
+	size_t totalSize = 0; //represents the total size of tasks
+	for (const PlannedTask& task : this->tasks) //iterate over the planned tasks
+		totalSize += task.totalSize; //add the size of task
+	return totalSize;
+}
\ No newline at end of file
@@ -0,0 +1,71 @@
+#ifndef _JobPlanner_H
+#define _JobPlanner_H
+#define _CRT_SECURE_NO_WARNINGS
+#include <iostream>
+#include <string.h>
+#include <vector>
+#include <unordered_map>
+#include "File.h"
+
+using namespace std;
+
+/**
+ * @brief Struct that represents one task of planned job, a single file or a batch of small files processed one after another.
+ */
+struct PlannedTask {
+	vector<File*> files; //represents the files of task
+	size_t totalSize = 0; //represents the total size of files in task
+	unsigned long long device = 0; //represents the device that holds the files of task
+};
+
+
+/**
+ * @brief Class that plans a job before it's dispatched to the thread pool.
+ * @brief Files that point to the same inode (hard links or same file listed twice) are merged so they're processed once,
+ * @brief tasks are ordered from largest to smallest to reduce total job time, and tiny files are bundled into shared tasks of same device.
+ * @brief Files discovered while the job runs are streamed in, their tasks are returned as soon as they're ready so they can't be ordered.
+ */
+class JobPlanner {
+private:
+	size_t batchThreshold = 256 * 1024; //represents the maximal size of file that can be bundled with other files
+	size_t batchSize = 8 * 1024 * 1024; //represents the maximal total size of a batch of small files
+	size_t batchMaxFiles = 64; //represents the maximal amount of files in a batch
+	vector<PlannedTask> tasks; //represents the planned tasks
+	unordered_map<File*, vector<File*>> aliases; //represents the duplicates of each processed file, they get the result of the file they alias
+
+	/**
+	 * @brief Struct that represents the identity of file on its device.
+	 */
+	struct FileIdentity {
+		unsigned long long device = 0; //represents the device or volume of file
+		unsigned long long index = 0; //represents the inode or file index on device
+		bool operator==(const FileIdentity& other) const { return this->device == other.device && this->index == other.index; }
+	};
+
+	/**
+	 * @brief Struct for hashing a FileIdentity.
+	 */
+	struct FileIdentityHash {
+		size_t operator()(const FileIdentity& identity) const { return hash<unsigned long long>()(identity.device * 0x9E3779B97F4A7C15ULL ^ identity.index); }
+	};
+
+	unordered_map<FileIdentity, File*, FileIdentityHash> identities; //represents the processed file of each identity
+	unordered_map<unsigned long long, PlannedTask> openBatches; //represents the batch of small files of each device that isn't full yet
+	vector<pair<File*, unsigned long long>> deduplicate(const vector<File*>& files);
+	void addFile(File* file, unsigned long long device, vector<PlannedTask>& readyTasks);
+
+public:
+	void plan(const vector<File*>& files);
+	void stream(const vector<File*>& files, vector<PlannedTask>& readyTasks);
+	void flush(vector<PlannedTask>& readyTasks);
+	const vector<PlannedTask>& getTasks() { return this->tasks; }
+	const vector<File*>& getAliases(File* file);
+	size_t getTotalSize();
+	size_t getBatchThreshold() { return this->batchThreshold; }
+	void setBatchThreshold(size_t size) { this->batchThreshold = size; }
+	size_t getBatchSize() { return this->batchSize; }
+	void setBatchSize(size_t size) { this->batchSize = size; }
+	size_t getBatchMaxFiles() { return this->batchMaxFiles; }
+	void setBatchMaxFiles(size_t number) { this->batchMaxFiles = max(number, (size_t)1); }
+};
+#endif
\ No newline at end of file
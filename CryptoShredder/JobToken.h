@@ -0,0 +1,63 @@
+#ifndef _JobToken_H
+#define _JobToken_H
+#define _CRT_SECURE_NO_WARNINGS
+#include <iostream>
+#include <string.h>
+#include <atomic>
+#include "Throttle.h"
+#include "FileEvent.h"
+#include "EventQueue.h"
+
+using namespace std;
+
+/**
+ * @brief Class that represents the shared state of one job: its cancellation token, failure flag, byte progress, bandwidth throttle
+ * @brief and the queue of file events.
+ * @brief Each FileHandler owns a token and each File of the job points to it, so independent jobs can run at the same time.
+ * @brief Workers add their bytes with relaxed atomics and the GUI samples them on a timer, so no lock is taken for progress.
+ */
+class JobToken {
+private:
+	atomic<bool> isCanceled = false; //flag for indicating that job was canceled
+	atomic<bool> isFailed = false; //flag for indicating that one of the files of job failed
+	atomic<size_t> bytesDone = 0; //represents the amount of bytes written by the workers of job
+	atomic<size_t> totalBytes = 0; //represents the amount of bytes the job writes when it finishes
+	Throttle throttle; //token bucket that applies the bandwidth cap on the reads and writes of job
+	EventQueue<FileEvent> events; //queue of finished files, pushed by workers and drained on GUI thread
+
+public:
+	/**
+	 * @brief Method for canceling the job, wakes the workers that wait for bandwidth so they see the cancelation.
+	 */
+	void cancel() {
+		this->isCanceled.store(true, memory_order_release); //set isCanceled flag
+		this->throttle.release(); //release the waiters of throttle
+	}
+
+	/**
+	 * @brief Method for resetting the token for a new job.
+	 */
+	void reset() {
+		this->isCanceled = false; //reset isCanceled flag
+		this->isFailed = false; //reset isFailed flag
+		this->bytesDone = 0; //reset the progress of job
+		this->totalBytes = 0; //reset the size of job, set again after planning
+	}
+
+	/**
+	 * @brief Method for adding written bytes to progress of job, called by workers in their hot loop.
+	 * @param size_t bytes
+	 */
+	void addProgress(size_t bytes) { this->bytesDone.fetch_add(bytes, memory_order_relaxed); }
+
+	bool getIsCanceled() const { return this->isCanceled.load(memory_order_acquire); }
+	bool getIsFailed() const { return this->isFailed.load(memory_order_acquire); }
+	void setIsFailed(bool state) { this->isFailed.store(state, memory_order_release); }
+	size_t getBytesDone() const { return this->bytesDone.load(memory_order_relaxed); }
+	size_t getTotalBytes() const { return this->totalBytes.load(memory_order_relaxed); }
+	void setTotalBytes(size_t bytes) { this->totalBytes.store(bytes, memory_order_relaxed); }
+	void addTotalBytes(size_t bytes) { this->totalBytes.fetch_add(bytes, memory_order_relaxed); }
+	Throttle& getThrottle() { return this->throttle; }
+	EventQueue<FileEvent>& getEvents() { return this->events; }
+};
+#endif
\ No newline at end of file
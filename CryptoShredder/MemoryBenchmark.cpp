@@ -0,0 +1,127 @@
+#include "MemoryBenchmark.h"
+#include <random>
+#include <chrono>
+
+
+static const string BenchmarkKey = "CryptoShredderMemoryBenchmarkKey"; //represents the AES-256 key of cipher jobs
+
+
+/**
+ * @brief Destructor of class, stops the worker and waits for it.
+ */
+MemoryBenchmark::~MemoryBenchmark() {
+	this->stop(); //stop the worker and wait for it
+}
+
+
+/**
+ * @brief Method for starting the benchmark on its worker, the result is ready when getIsFinished returns true.
+ */
+void MemoryBenchmark::start() {
+	if (!this->worker.joinable()) //if true benchmark wasn't started yet
+		this->worker = thread(&MemoryBenchmark::run, this); //start the worker
+}
+
+
+/**
+ * @brief Method for stopping the benchmark and waiting for it, the job that runs is canceled and the backend of files is restored.
+ */
+void MemoryBenchmark::stop() {
+	{
+		lock_guard<mutex> lock(this->handlerMutex); //lock the mutex of handler
+		this->isStopped.store(true); //tell the worker not to start another job
+		if (this->handler) //if true a job runs, we cancel it
+			this->handler->cancelProcess();
+	}
+	if (this->worker.joinable()) //if true the worker was started
+		this->worker.join(); //wait for worker
+}
+
+
+/**
+ * @brief Function for filling the contents of file with pseudo random bytes, same index always gives same contents so decrypted files can be verified.
+ * @param size_t index
+ * @param vector<unsigned char> contents
+ */
+void MemoryBenchmark::FillFile(size_t index, vector<unsigned char>& contents) {
+	mt19937_64 generator(index); //represents the generator of file, seeded with its index
+	for (size_t i = 0; i < contents.size(); i += sizeof(uint64_t)) { //fill eight bytes at a time
+		uint64_t value = generator(); //represents the next random bytes
+		memcpy(contents.data() + i, &value, min(sizeof(uint64_t), contents.size() - i));
+	}
+}
+
+
+/**
+ * @brief Method for running the benchmark, runs on the worker thread.
+ * @brief Files are encrypted, decrypted and checked against their contents, then wiped with one pass, each step is a job of its own.
+ */
+void MemoryBenchmark::run() {
+	size_t numOfFiles = MemoryBenchmark::NumOfLargeFiles + MemoryBenchmark::NumOfSmallFiles; //represents the amount of files
+	for (size_t i = 0; i < numOfFiles && !this->isStopped.load(); i++) { //create each file in memory
+		vector<unsigned char> contents(i < MemoryBenchmark::NumOfLargeFiles ? MemoryBenchmark::LargeFileSize : MemoryBenchmark::SmallFileSize); //represents the contents of file
+		MemoryBenchmark::FillFile(i, contents);
+		this->filePaths.push_back("benchmark/file" + to_string(i) + ".bin"); //paths only exist in memory
+		this->memory.addFile(this->filePaths.back(), contents);
+		this->totalBytes += contents.size();
+	}
+	IOBackend* previousBackend = File::getBackend(); //represents the backend of files before benchmark
+	File::setBackend(&this->memory); //jobs open their files in memory
+	MetadataLoader::Load(this->filePaths, this->fileMetadata); //load the metadata of files once, jobs don't change their sizes
+	this->result.encryptRate = this->runJob([](FileHandler& handler) { handler.initCipher(BenchmarkKey); });
+	this->result.decryptRate = this->runJob([](FileHandler& handler) { handler.initCipher(BenchmarkKey, true); });
+	bool isVerified = this->result.encryptRate > 0 && this->result.decryptRate > 0 && this->verifyFiles(); //decrypted files must match their contents
+	this->result.wipeRate = this->runJob([](FileHandler& handler) { handler.initWipe(1, false); });
+	this->result.isVerified = isVerified && this->result.wipeRate > 0;
+	File::setBackend(previousBackend); //restore the backend, handlers of jobs joined their workers
+	for (const string& filePath : this->filePaths) //release the memory of files
+		this->memory.remove(filePath);
+	this->isFinished.store(true); //mark that worker finished
+}
+
+
+/**
+ * @brief Method for running one job on all files and measuring it, returns the rate of job in MB per second or zero if it was canceled or failed.
+ * @param function<void(FileHandler&)> init
+ */
+double MemoryBenchmark::runJob(const function<void(FileHandler&)>& init) {
+	if (this->isStopped.load()) //if true we don't start another job
+		return 0;
+	SignalProxy signal; //signal object of job, nothing is connected to it so the GUI doesn't see benchmark jobs
+	FileHandler handler(this->filePaths, this->fileMetadata, &signal); //handler of job, files use the metadata that was loaded from memory
+	handler.applySettings(this->settings); //jobs run with the pool, split and throttle of GUI jobs
+	chrono::steady_clock::time_point startTime = chrono::steady_clock::now(); //represents the start of job
+	init(handler); //start the job, tasks run on the pool of handler
+	{
+		lock_guard<mutex> lock(this->handlerMutex); //lock the mutex of handler
+		if (this->isStopped.load()) //if true benchmark was stopped while we started the job
+			handler.cancelProcess();
+		else //else stop can cancel the job from now on
+			this->handler = &handler;
+	}
+	handler.getJobFuture().wait(); //wait for all tasks of job
+	double seconds = chrono::duration<double>(chrono::steady_clock::now() - startTime).count(); //represents the duration of job
+	{
+		lock_guard<mutex> lock(this->handlerMutex); //lock the mutex of handler
+		this->handler = NULL;
+	}
+	if (handler.getJob().getIsCanceled() || handler.getJob().getIsFailed() || seconds <= 0) //if true job has no rate
+		return 0;
+	return (double)this->totalBytes / (1024.0 * 1024.0) / seconds;
+}
+
+
+/**
+ * @brief Method for checking that each file in memory holds its original contents, returns false on first mismatch.
+ */
+bool MemoryBenchmark::verifyFiles() {
+	vector<unsigned char> expected; //represents the original contents of current file
+	for (size_t i = 0; i < this->filePaths.size() && !this->isStopped.load(); i++) { //check each file
+		vector<unsigned char> contents = this->memory.getFile(this->filePaths[i]); //represents the contents of file after the jobs
+		expected.resize(contents.size());
+		MemoryBenchmark::FillFile(i, expected);
+		if (contents != expected) //if true the file wasn't restored
+			return false;
+	}
+	return !this->isStopped.load();
+}
\ No newline at end of file
@@ -0,0 +1,65 @@
+#ifndef _MemoryBenchmark_H
+#define _MemoryBenchmark_H
+#define _CRT_SECURE_NO_WARNINGS
+#include <iostream>
+#include <string.h>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <functional>
+#include "FileHandler.h"
+#include "IO/MemoryBackend.h"
+
+using namespace std;
+
+/**
+ * @brief Struct that represents the result of benchmark, rates are in MB per second.
+ */
+struct BenchmarkResult {
+	double encryptRate = 0; //represents the rate of encryption
+	double decryptRate = 0; //represents the rate of decryption
+	double wipeRate = 0; //represents the rate of wipe with one pass
+	bool isVerified = false; //flag for indicating that every job finished and decrypted files matched their original contents
+};
+
+
+/**
+ * @brief Class that measures the wipe and cipher engines on files in RAM on a background thread, so the rates show the engines without a disk.
+ * @brief Each job runs through FileHandler like a job of GUI, with its settings, pool, planner and split of large files, on files of a MemoryBackend.
+ * @brief The backend of files is replaced by the MemoryBackend while benchmark runs, so no job or metadata load may run at the same time.
+ */
+class MemoryBenchmark {
+private:
+	MemoryBackend memory; //backend that holds the files of benchmark
+	JobSettings settings; //represents the settings of benchmark jobs, same as jobs of GUI
+	vector<string> filePaths; //represents the paths of files in memory
+	vector<FileMetadata> fileMetadata; //represents the metadata of files in memory, loaded once and shared by all jobs
+	size_t totalBytes = 0; //represents the size of all files
+	thread worker; //thread that runs the jobs
+	mutex handlerMutex; //mutex for handler, stop cancels the job that runs
+	FileHandler* handler = NULL; //represents the handler of job that runs
+	BenchmarkResult result; //represents the result, valid once worker finished
+	atomic<bool> isStopped = false; //flag for indicating that benchmark was stopped
+	atomic<bool> isFinished = false; //flag for indicating that worker finished
+	void run();
+	double runJob(const function<void(FileHandler&)>& init);
+	bool verifyFiles();
+	static void FillFile(size_t index, vector<unsigned char>& contents);
+
+public:
+	static constexpr size_t NumOfLargeFiles = 4; //amount of large files, they're split into regions like large files of GUI
+	static constexpr size_t LargeFileSize = 64 * 1024 * 1024; //size of each large file
+	static constexpr size_t NumOfSmallFiles = 256; //amount of small files, they're processed in batches
+	static constexpr size_t SmallFileSize = 64 * 1024; //size of each small file
+	MemoryBenchmark(const JobSettings& settings = JobSettings()) : settings(settings) {}
+	virtual ~MemoryBenchmark();
+	MemoryBenchmark(const MemoryBenchmark&) = delete; //prevent copy
+	void operator=(const MemoryBenchmark&) = delete; //prevent assignment
+	void start();
+	void stop();
+	BenchmarkResult getResult() const { return this->result; }
+	bool getIsFinished() const { return this->isFinished.load(); }
+	bool getIsStopped() const { return this->isStopped.load(); }
+};
+#endif
\ No newline at end of file
@@ -0,0 +1,34 @@
+#include "MetadataLoader.h"
+#include "File.h"
+
+
+/**
+ * @brief Function for loading the metadata of given native paths with the backend of files, metadata[i] belongs to filePaths[i].
+ * @brief The calling thread loads the first range and waits for the other threads, paths that don't exist get metadata that doesn't exist.
+ * @param vector<string> filePaths
+ * @param vector<FileMetadata> metadata
+ * @param size_t numOfThreads
+ */
+void MetadataLoader::Load(const vector<string>& filePaths, vector<FileMetadata>& metadata, size_t numOfThreads) {
+	metadata.assign(filePaths.size(), FileMetadata()); //clear the metadata of paths
+	numOfThreads = max(min(numOfThreads, filePaths.size() / MinPathsPerThread), (size_t)1); //represents the amount of threads we use
+	size_t rangeSize = (filePaths.size() + numOfThreads - 1) / numOfThreads; //represents the amount of paths in each range
+
+	//load the metadata of a range, paths are converted on the loading thread too
+	auto loadRange = [&filePaths, &metadata](size_t start, size_t end) {
+		vector<filesystem::path> paths; //represents the paths of range
+		paths.reserve(end - start);
+		for (size_t i = start; i < end; i++) //convert each path to the path type of file system
+			paths.push_back(File::NativePath(filePaths[i]));
+		vector<FileMetadata> rangeMetadata; //represents the metadata of range
+		File::getBackend()->getMetadataBatch(paths, rangeMetadata); //load the whole range through the backend
+		copy(rangeMetadata.begin(), rangeMetadata.end(), metadata.begin() + start); //save the metadata of range
+	};
+
+	vector<thread> loaders; //represents the other loader threads
+	for (size_t start = rangeSize; start < filePaths.size(); start += rangeSize) //start a thread for each range after the first
+		loaders.emplace_back(loadRange, start, min(start + rangeSize, filePaths.size()));
+	loadRange(0, min(rangeSize, filePaths.size())); //calling thread loads the first range
+	for (thread& loader : loaders) //wait for the other loaders
+		loader.join();
+}
\ No newline at end of file
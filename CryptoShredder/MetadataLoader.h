@@ -0,0 +1,22 @@
+#ifndef _MetadataLoader_H
+#define _MetadataLoader_H
+#define _CRT_SECURE_NO_WARNINGS
+#include <iostream>
+#include <string.h>
+#include <vector>
+#include <thread>
+#include "IO/IOBackend.h"
+
+using namespace std;
+
+/**
+ * @brief Class that loads the metadata of many files at once, so adding thousands of files doesn't cost a status call each on one thread.
+ * @brief Paths are split into contiguous ranges and each range is loaded by its own thread through the batch method of current backend,
+ * @brief a backend with io_uring queues the statx requests of a whole range at once and the others issue a single status call per file.
+ */
+class MetadataLoader {
+public:
+	static constexpr size_t MinPathsPerThread = 512; //minimal amount of paths for each thread, smaller lists aren't worth starting a thread
+	static void Load(const vector<string>& filePaths, vector<FileMetadata>& metadata, size_t numOfThreads = max(thread::hardware_concurrency(), 1u));
+};
+#endif
\ No newline at end of file
@@ -0,0 +1,226 @@
+#include "PatternSearch.h"
+#include <bit>
+
+
+/**
+ * @brief Constructor for pattern search, builds the Horspool shifts of pattern.
+ * @param vector<unsigned char> pattern
+ */
+PatternSearch::PatternSearch(const vector<unsigned char>& pattern) : pattern(pattern) {
+	size_t size = this->pattern.size(); //represents the size of pattern
+	for (size_t i = 0; i < 256; i++) //bytes that aren't in pattern shift the window past them
+		this->skip[i] = size;
+	for (size_t i = 0; i + 1 < size; i++) //bytes of pattern shift the window to their last occurrence, last byte of pattern isn't counted
+		this->skip[this->pattern[i]] = size - 1 - i;
+}
+
+
+/**
+ * @brief Destructor for pattern search, stops the worker and waits for it.
+ */
+PatternSearch::~PatternSearch() {
+	this->stop(); //stop the worker and wait for it
+	this->file.close(); //close the mapping of file
+}
+
+
+/**
+ * @brief Function for parsing HEX input into bytes, whitespace between digits is ignored. Returns false if input isn't an even amount of HEX digits.
+ * @param string input
+ * @param vector<unsigned char> pattern
+ */
+bool PatternSearch::ParseHex(const string& input, vector<unsigned char>& pattern) {
+	pattern.clear(); //clear previous bytes
+	int high = -1; //represents the high nibble of current byte, -1 if we don't have it yet
+	for (char c : input) { //parse each character of input
+		int nibble = -1; //represents the value of character
+		if (c >= '0' && c <= '9')
+			nibble = c - '0';
+		else if (c >= 'a' && c <= 'f')
+			nibble = c - 'a' + 10;
+		else if (c >= 'A' && c <= 'F')
+			nibble = c - 'A' + 10;
+		else if (c == ' ' || c == '\t') //whitespace separates bytes
+			continue;
+		else //invalid character
+			return false;
+		if (high == -1) //first digit of byte
+			high = nibble;
+		else { //second digit of byte
+			pattern.push_back((unsigned char)(high << 4 | nibble));
+			high = -1;
+		}
+	}
+	return high == -1 && !pattern.empty(); //input must have complete bytes
+}
+
+
+/**
+ * @brief Method for opening the file for reading and starting the worker, returns false if the file couldn't be opened.
+ * @param path filePath
+ */
+bool PatternSearch::start(const filesystem::path& filePath) {
+	if (this->pattern.empty() || !this->file.open(filePath, true)) //if true we can't search
+		return false;
+	this->fileSize = this->file.size(); //save the file size
+	this->file.adviseSequential(); //we read the file once from start to end
+	this->worker = thread(&PatternSearch::run, this); //start the worker
+	return true;
+}
+
+
+/**
+ * @brief Method for stopping the worker and waiting for it, hits found so far stay available.
+ */
+void PatternSearch::stop() {
+	this->isStopped.store(true); //tell the worker to stop after current chunk
+	if (this->worker.joinable()) //if true the worker was started
+		this->worker.join(); //wait for worker
+}
+
+
+/**
+ * @brief Method for taking the hits that were found since last call, returns the amount of hits taken.
+ * @param vector<size_t> hits
+ */
+size_t PatternSearch::takeHits(vector<size_t>& hits) {
+	lock_guard<mutex> lock(this->hitMutex); //lock the mutex of hits
+	size_t count = this->pendingHits.size(); //represents the amount of hits taken
+	hits.insert(hits.end(), this->pendingHits.begin(), this->pendingHits.end()); //append the hits in order of offset
+	this->pendingHits.clear(); //clear the taken hits
+	return count;
+}
+
+
+/**
+ * @brief Method for scanning the file chunk by chunk, runs on the worker thread.
+ * @brief Each chunk is mapped with the pattern size minus one bytes of next chunk, so hits across the border are found once.
+ */
+void PatternSearch::run() {
+	size_t size = this->pattern.size(); //represents the size of pattern
+	vector<size_t> hits; //represents the hits of current chunk that are kept
+	for (size_t chunk = 0; chunk < this->fileSize && !this->isStopped.load(); chunk += PatternSearch::ChunkSize) { //scan each chunk until stopped
+		if (this->fileSize - chunk >= size) { //if true the pattern fits in rest of file
+			size_t length = min(this->fileSize - chunk, PatternSearch::ChunkSize + size - 1); //represents the mapped length of chunk
+			const unsigned char* data = this->file.map(chunk, length); //map the chunk
+			if (data == NULL) { //if true we failed mapping the chunk
+				this->isFailed.store(true);
+				break;
+			}
+			size_t count = 0; //represents the amount of hits of chunk
+			for (size_t position = this->find(data, length, 0); position != PatternSearch::NotFound; position = this->find(data, length, position + 1)) { //find each hit of chunk
+				if (this->keptHits + hits.size() < PatternSearch::MaxHits) //if true we keep the hit for GUI
+					hits.push_back(chunk + position);
+				count++;
+			}
+			if (!hits.empty()) { //if true we pass the hits to GUI
+				lock_guard<mutex> lock(this->hitMutex); //lock the mutex of hits
+				this->pendingHits.insert(this->pendingHits.end(), hits.begin(), hits.end());
+				this->keptHits += hits.size();
+				hits.clear();
+			}
+			this->hitCount.fetch_add(count); //count all hits of chunk
+		}
+		this->bytesScanned.store(min(this->fileSize, chunk + PatternSearch::ChunkSize)); //update the progress
+	}
+	this->file.unmap(); //unmap the last chunk
+	this->isFinished.store(true); //mark that worker finished
+}
+
+
+/**
+ * @brief Method for finding the first occurrence of pattern in data at or after given position, returns NotFound if there's none.
+ * @brief The SIMD filter is memory bound at every pattern size, so Horspool is only used by CPUs without it.
+ * @param unsigned char* data
+ * @param size_t length
+ * @param size_t from
+ */
+size_t PatternSearch::find(const unsigned char* data, size_t length, size_t from) const {
+	size_t size = this->pattern.size(); //represents the size of pattern
+	if (size == 0 || length < size || from > length - size) //if true the pattern doesn't fit
+		return PatternSearch::NotFound;
+#ifdef CPU_SIMD
+	if (CpuFeatures::SimdLevel() == CpuFeatures::AVX2) //if true we filter 32 positions at once
+		return PatternSearch::FindAVX2(data, length, from, this->pattern.data(), size);
+	return PatternSearch::FindSSE2(data, length, from, this->pattern.data(), size); //SSE2 is part of x86-64
+#else
+	return this->findHorspool(data, length, from);
+#endif
+}
+
+
+/**
+ * @brief Method for finding the pattern with Boyer-Moore-Horspool, the window is shifted by the last byte under it.
+ * @brief The first and last byte are compared before the whole pattern so most mismatches cost a single compare.
+ * @param unsigned char* data
+ * @param size_t length
+ * @param size_t from
+ */
+size_t PatternSearch::findHorspool(const unsigned char* data, size_t length, size_t from) const {
+	size_t size = this->pattern.size(); //represents the size of pattern
+	const unsigned char* pattern = this->pattern.data(); //represents the pattern
+	unsigned char first = pattern[0], last = pattern[size - 1]; //represents the first and last byte of pattern
+	for (size_t position = from; position <= length - size; position += this->skip[data[position + size - 1]]) { //shift the window by its last byte
+		const unsigned char* window = data + position; //represents the current window
+		if (window[size - 1] == last && window[0] == first && memcmp(window, pattern, size) == 0) //if true the whole pattern matches
+			return position;
+	}
+	return PatternSearch::NotFound;
+}
+
+
+#ifdef CPU_SIMD
+/**
+ * @brief Function for finding the pattern with SSE2, compares the first and last byte of pattern at 16 positions and verifies the positions where both match.
+ * @param unsigned char* data
+ * @param size_t length
+ * @param size_t from
+ * @param unsigned char* pattern
+ * @param size_t patternSize
+ */
+size_t PatternSearch::FindSSE2(const unsigned char* data, size_t length, size_t from, const unsigned char* pattern, size_t patternSize) {
+	__m128i first = _mm_set1_epi8((char)pattern[0]); //represents the first byte in each lane
+	__m128i last = _mm_set1_epi8((char)pattern[patternSize - 1]); //represents the last byte in each lane
+	size_t position = from; //represents the first position of current block
+	for (; position + patternSize - 1 + 16 <= length; position += 16) { //check 16 positions at a time
+		__m128i starts = _mm_loadu_si128((const __m128i*)(data + position)); //represents the first byte of each position
+		__m128i ends = _mm_loadu_si128((const __m128i*)(data + position + patternSize - 1)); //represents the last byte of each position
+		unsigned mask = (unsigned)_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(starts, first), _mm_cmpeq_epi8(ends, last))); //collect the positions where both bytes match
+		for (; mask != 0; mask &= mask - 1) { //verify each candidate from lowest position
+			size_t candidate = position + countr_zero(mask); //represents the position of candidate
+			if (memcmp(data + candidate + 1, pattern + 1, patternSize < 2 ? 0 : patternSize - 2) == 0) //if true the whole pattern matches
+				return candidate;
+		}
+	}
+	for (; position <= length - patternSize; position++) //check the positions that are left
+		if (data[position] == pattern[0] && memcmp(data + position, pattern, patternSize) == 0)
+			return position;
+	return PatternSearch::NotFound;
+}
+
+
+/**
+ * @brief Function for finding the pattern with AVX2, compares the first and last byte of pattern at 32 positions and verifies the positions where both match.
+ * @param unsigned char* data
+ * @param size_t length
+ * @param size_t from
+ * @param unsigned char* pattern
+ * @param size_t patternSize
+ */
+CPU_TARGET("avx2") size_t PatternSearch::FindAVX2(const unsigned char* data, size_t length, size_t from, const unsigned char* pattern, size_t patternSize) {
+	__m256i first = _mm256_set1_epi8((char)pattern[0]); //represents the first byte in each lane
+	__m256i last = _mm256_set1_epi8((char)pattern[patternSize - 1]); //represents the last byte in each lane
+	size_t position = from; //represents the first position of current block
+	for (; position + patternSize - 1 + 32 <= length; position += 32) { //check 32 positions at a time
+		__m256i starts = _mm256_loadu_si256((const __m256i*)(data + position)); //represents the first byte of each position
+		__m256i ends = _mm256_loadu_si256((const __m256i*)(data + position + patternSize - 1)); //represents the last byte of each position
+		unsigned mask = (unsigned)_mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(starts, first), _mm256_cmpeq_epi8(ends, last))); //collect the positions where both bytes match
+		for (; mask != 0; mask &= mask - 1) { //verify each candidate from lowest position
+			size_t candidate = position + countr_zero(mask); //represents the position of candidate
+			if (memcmp(data + candidate + 1, pattern + 1, patternSize < 2 ? 0 : patternSize - 2) == 0) //if true the whole pattern matches
+				return candidate;
+		}
+	}
+	return PatternSearch::FindSSE2(data, length, position, pattern, patternSize); //SSE2 checks the positions that are left
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,62 @@
+#ifndef _PatternSearch_H
+#define _PatternSearch_H
+#define _CRT_SECURE_NO_WARNINGS
+#include <iostream>
+#include <string.h>
+#include <vector>
+#include <filesystem>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include "CpuFeatures.h"
+#include "IO/MmapBackend.h"
+
+using namespace std;
+
+/**
+ * @brief Class that searches a file for a byte pattern on a background thread, the file is mapped for reading and scanned in chunks.
+ * @brief On x86-64 a SIMD filter compares the first and last byte of pattern at 16 or 32 positions at once and only positions where both match
+ * @brief are compared in full, other CPUs use Boyer-Moore-Horspool whose shifts skip most of the bytes.
+ * @brief Hits are collected by the worker and taken by the GUI on its timer, so results stream in while the scan runs.
+ */
+class PatternSearch {
+private:
+	vector<unsigned char> pattern; //represents the searched bytes
+	size_t skip[256] = {}; //represents the Horspool shift of each byte at the end of window
+	MappedFile file; //read-only mapping of file, separate from mapping of viewer
+	size_t fileSize = 0; //represents the size of file
+	thread worker; //thread that scans the file
+	atomic<bool> isStopped = false; //flag for indicating that search was stopped
+	atomic<bool> isFinished = false; //flag for indicating that worker finished scanning
+	atomic<bool> isFailed = false; //flag for indicating that a chunk of file couldn't be mapped
+	atomic<size_t> bytesScanned = 0; //represents the amount of bytes scanned
+	atomic<size_t> hitCount = 0; //represents the amount of hits found, including hits that weren't kept
+	mutex hitMutex; //mutex for pendingHits
+	vector<size_t> pendingHits; //represents the offsets of hits that GUI didn't take yet
+	size_t keptHits = 0; //represents the amount of hits kept for GUI
+	void run();
+	size_t findHorspool(const unsigned char* data, size_t length, size_t from) const;
+	static size_t FindSSE2(const unsigned char* data, size_t length, size_t from, const unsigned char* pattern, size_t patternSize);
+	static size_t FindAVX2(const unsigned char* data, size_t length, size_t from, const unsigned char* pattern, size_t patternSize);
+
+public:
+	static constexpr size_t NotFound = SIZE_MAX; //represents that pattern wasn't found
+	static constexpr size_t ChunkSize = 64 * 1024 * 1024; //amount of bytes scanned between checks for stop, chunks overlap by the pattern size
+	static constexpr size_t MaxHits = 10000; //maximal amount of hits kept for GUI, later hits are only counted
+	PatternSearch(const vector<unsigned char>& pattern);
+	virtual ~PatternSearch();
+	PatternSearch(const PatternSearch&) = delete; //prevent copy
+	void operator=(const PatternSearch&) = delete; //prevent assignment
+	static bool ParseHex(const string& input, vector<unsigned char>& pattern);
+	bool start(const filesystem::path& filePath);
+	void stop();
+	size_t find(const unsigned char* data, size_t length, size_t from) const;
+	size_t takeHits(vector<size_t>& hits);
+	size_t getFileSize() const { return this->fileSize; }
+	size_t getBytesScanned() const { return this->bytesScanned.load(); }
+	size_t getHitCount() const { return this->hitCount.load(); }
+	bool getIsFinished() const { return this->isFinished.load(); }
+	bool getIsStopped() const { return this->isStopped.load(); }
+	bool getIsFailed() const { return this->isFailed.load(); }
+};
+#endif
\ No newline at end of file
@@ -0,0 +1,140 @@
+#include "SettingsWindow.h"
+
+
+bool SettingsWindow::isInstance = false; //initialize the static isInstance flag
+
+
+/**
+ * @brief Constructor of class, lists the backends of files, probes which of them work on this system and shows the settings of jobs.
+ * @param QWidget* parent
+ * @param JobSettings settings
+ */
+SettingsWindow::SettingsWindow(QWidget* parent, JobSettings& settings) : QDialog(parent), settings(settings) {
+    ui.setupUi(this); //set ui elements
+    this->setAttribute(Qt::WA_DeleteOnClose); //ensure that object gets deleted when window closes
+    this->setWindowFlags(windowFlags() & ~Qt::WindowContextHelpButtonHint); //remove hint from QDialog
+    this->benchmarkTimer = new QTimer(this); //initialize the timer that checks the benchmark
+    this->benchmarkTimer->setInterval(BenchmarkInterval); //check the benchmark at a fixed rate
+
+    QStandardItemModel* backendModel = qobject_cast<QStandardItemModel*>(ui.BackendComboBox->model()); //represents the items of backend comboBox
+    const vector<IOBackend*>& backends = File::getBackends(); //represents the backends that can be chosen
+    for (size_t i = 0; i < backends.size(); i++) { //add each backend to comboBox
+        ui.BackendComboBox->addItem(QString::fromStdString(backends[i]->getName()));
+        if (!backends[i]->isAvailable()) { //if true the backend doesn't work on this system, it's shown but can't be chosen
+            backendModel->item((int)i)->setEnabled(false);
+            backendModel->item((int)i)->setToolTip("Not available on this system.");
+        }
+        if (backends[i] == File::getBackend()) //if true it's the backend files use now
+            ui.BackendComboBox->setCurrentIndex((int)i);
+    }
+    ui.BackgroundCheckBox->setChecked(this->settings.backgroundMode); //show the settings of jobs
+    ui.BandwidthSpinBox->setValue((int)this->settings.bandwidthLimit);
+    ui.PoolSizeSpinBox->setValue((int)this->settings.poolSize);
+    ui.WorkersPerFileSpinBox->setValue((int)this->settings.workersPerFile);
+    ui.SplitThresholdSpinBox->setValue((int)(this->settings.splitThreshold / (1024 * 1024)));
+
+    connect(ui.OKButton, &QPushButton::clicked, this, &SettingsWindow::applySettings); //connect OK button to apply the settings and close the window
+    connect(ui.BenchmarkButton, &QPushButton::clicked, this, &SettingsWindow::startBenchmark); //connect benchmark button to start the benchmark
+    connect(this->benchmarkTimer, &QTimer::timeout, this, &SettingsWindow::updateBenchmark); //connect signal for checking the benchmark
+    this->setModal(true); //set the dialog model to block interactions with main GUI
+    this->show(); //show window
+}
+
+
+/**
+ * @brief Destructor of class, a running benchmark is stopped and the backend of files is restored before window is deleted.
+ */
+SettingsWindow::~SettingsWindow() {
+    this->benchmarkTimer->stop(); //stop checking the benchmark
+    this->benchmark.reset(); //stop the benchmark and wait for its worker
+    delete this->benchmarkTimer; //delete the benchmark timer
+    if (isInstance) //if true we set back isInstance flag to false
+        isInstance = false; //set the isInstance flag to false
+}
+
+
+/**
+ * @brief Method for getting instance for singleton class.
+ * @param QWidget* parent
+ * @param JobSettings settings
+ */
+SettingsWindow* SettingsWindow::getInstance(QWidget* parent, JobSettings& settings) {
+    if (!isInstance) { //if true we can give the user an instance for SettingsWindow
+        isInstance = true; //indicating that we're creating an instance for class
+        return new SettingsWindow(parent, settings); //return the new instance
+    }
+    return NULL; //else we return NULL indicating that there's a SettingsWindow already open
+}
+
+
+/**
+ * @brief Method for getting the settings of jobs that are chosen in window.
+ */
+JobSettings SettingsWindow::getChosenSettings() {
+    JobSettings chosen; //represents the chosen settings
+    chosen.backgroundMode = ui.BackgroundCheckBox->isChecked();
+    chosen.bandwidthLimit = (size_t)ui.BandwidthSpinBox->value(); //zero is shown as unlimited
+    chosen.poolSize = (size_t)ui.PoolSizeSpinBox->value();
+    chosen.workersPerFile = (size_t)ui.WorkersPerFileSpinBox->value();
+    chosen.splitThreshold = (size_t)ui.SplitThresholdSpinBox->value() * 1024 * 1024; //spinBox shows MB
+    return chosen;
+}
+
+
+/**
+ * @brief Method for enabling or disabling the controls of window, they're disabled while benchmark runs.
+ * @param bool state
+ */
+void SettingsWindow::setControlsEnabled(bool state) {
+    ui.BackendComboBox->setEnabled(state); //backend is restored when benchmark finishes
+    ui.BackgroundCheckBox->setEnabled(state); //benchmark runs with the settings it started with
+    ui.BandwidthSpinBox->setEnabled(state);
+    ui.PoolSizeSpinBox->setEnabled(state);
+    ui.WorkersPerFileSpinBox->setEnabled(state);
+    ui.SplitThresholdSpinBox->setEnabled(state);
+    ui.BenchmarkButton->setEnabled(state); //benchmark runs once at a time
+    ui.OKButton->setEnabled(state);
+}
+
+
+/**
+ * @brief Method for applying the chosen settings and closing the window, main GUI applies the settings of jobs to each new job.
+ */
+void SettingsWindow::applySettings() {
+    int backendIndex = ui.BackendComboBox->currentIndex(); //represents the chosen backend
+    if (backendIndex >= 0 && File::getBackends()[backendIndex]->isAvailable()) //if true the backend can be used, files use it from next job
+        File::setBackend(File::getBackends()[backendIndex]);
+    this->settings = this->getChosenSettings(); //save the settings of jobs
+    this->accept(); //close the window
+}
+
+
+/**
+ * @brief Method for starting the benchmark in RAM with the chosen settings of jobs, settings can't be applied until it finishes because it replaces the backend of files while it runs.
+ */
+void SettingsWindow::startBenchmark() {
+    if (this->benchmark) //if true benchmark is already running
+        return;
+    this->setControlsEnabled(false); //controls are enabled when benchmark finishes
+    ui.BenchmarkLabel->setText("Running benchmark in RAM...");
+    this->benchmark = make_unique<MemoryBenchmark>(this->getChosenSettings()); //create the benchmark
+    this->benchmark->start(); //start the jobs on its worker
+    this->benchmarkTimer->start(); //start checking the benchmark
+}
+
+
+/**
+ * @brief Method for showing the result of benchmark when it finishes, called by the benchmark timer.
+ */
+void SettingsWindow::updateBenchmark() {
+    if (!this->benchmark || !this->benchmark->getIsFinished()) //if true benchmark is still running
+        return;
+    this->benchmarkTimer->stop(); //benchmark finished so we stop checking
+    BenchmarkResult result = this->benchmark->getResult(); //represents the result of benchmark
+    this->benchmark.reset(); //join the worker of benchmark
+    if (result.isVerified) //if true all jobs finished and files were restored
+        ui.BenchmarkLabel->setText(QString("Encrypt %1 MB/s - Decrypt %2 MB/s - Wipe %3 MB/s").arg(result.encryptRate, 0, 'f', 0).arg(result.decryptRate, 0, 'f', 0).arg(result.wipeRate, 0, 'f', 0));
+    else //else a job failed or decrypted files didn't match
+        ui.BenchmarkLabel->setText("Benchmark failed.");
+    this->setControlsEnabled(true); //settings can be changed and applied again
+}
\ No newline at end of file
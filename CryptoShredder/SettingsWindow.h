@@ -0,0 +1,47 @@
+#ifndef _SettingsWindow_H
+#define _SettingsWindow_H
+#define _CRT_SECURE_NO_WARNINGS
+#include <QtWidgets/QMainWindow>
+#include <QMessageBox>
+#include <QStandardItemModel>
+#include <QTimer>
+#include <iostream>
+#include <string.h>
+#include <vector>
+#include <memory>
+#include "ui_SettingsWindow.h"
+#include "File.h"
+#include "MemoryBenchmark.h"
+
+using namespace std;
+
+/**
+ * @brief Class for the settings of file processing, the I/O backend of files and the settings of jobs are chosen here and the engines can be benchmarked in RAM.
+ * @brief Backends that don't work on this system are listed but can't be chosen. Settings are only opened while no job runs.
+ */
+class SettingsWindow : public QDialog {
+    Q_OBJECT
+
+private:
+    Ui::SettingsWindow ui; //ui element for window
+    JobSettings& settings; //represents the settings of jobs, owned by main GUI
+    unique_ptr<MemoryBenchmark> benchmark; //represents the running benchmark, NULL if benchmark isn't running
+    QTimer* benchmarkTimer = NULL; //timer that checks if benchmark finished
+    static constexpr int BenchmarkInterval = 100; //interval in milliseconds between checks of running benchmark
+    SettingsWindow(QWidget* parent, JobSettings& settings); //constructor
+    ~SettingsWindow(); //destructor
+    SettingsWindow(const SettingsWindow&) = delete; //prevent copy
+    void operator=(const SettingsWindow&) = delete; //prevent assignment
+    static bool isInstance; //static bool instance flag for indication
+    JobSettings getChosenSettings();
+    void setControlsEnabled(bool state);
+
+public:
+    static SettingsWindow* getInstance(QWidget* parent, JobSettings& settings);
+
+private slots: //here we declare the slot methods
+    void applySettings();
+    void startBenchmark();
+    void updateBenchmark();
+};
+#endif
\ No newline at end of file
@@ -16,25 +16,15 @@ class SignalProxy : public QObject {
 	Q_OBJECT
 
 signals: //here we declare the signals for GUI
-	void signalUpdateListView(const QString& fileDictionaryName, const QString& fileName, const QString& tag); //signal to update GUI listView 
 	void signalMessageBox(const QString& title, const QString& text, const QString& type); //signal to show GUI messagebox
-	void signalSetListViewTags(const QString& tag, const QString& currentTag); //signal for set tags in GUI listView
+	void signalJobFinished(); //signal to indicate that all tasks of job finished
+	void signalMetadataLoaded(); //signal to indicate that metadata of chosen files was loaded
 
 public:
 	SignalProxy() {}; //ctor
 	~SignalProxy() {}; //dtor
 
 public slots: //here we declare the slot methods
-	/**
-	 * @brief Method to emit a signal to GUI to update listView.
-	 * @param string fileDictionaryName
-	 * @param string fileName
-	 * @param string tag
-	 */
-	void sendSignalUpdateListView(const string& fileDictionaryName, const string& fileName, const string& tag) {
-		emit signalUpdateListView(QString::fromStdString(fileDictionaryName), QString::fromStdString(fileName), QString::fromStdString(tag));
-	}
-
 	/**
 	 * @brief Method to emit signal to GUI to show messagebox.
 	 * @param string title
@@ -46,12 +36,17 @@ public slots: //here we declare the slot methods
 	}
 
 	/**
-	 * @brief Method to emit signal to GUI to set tags in listView.
-	 * @param string tag
-	 * @param string currentTag
+	 * @brief Method to emit signal to GUI that all tasks of job finished.
+	 */
+	void sendSignalJobFinished() {
+		emit signalJobFinished();
+	}
+
+	/**
+	 * @brief Method to emit signal to GUI that metadata of chosen files was loaded.
 	 */
-	void sendSignalSetListViewTags(const string& tag, const string& currentTag) {
-		emit signalSetListViewTags(QString::fromStdString(tag), QString::fromStdString(currentTag));
+	void sendSignalMetadataLoaded() {
+		emit signalMetadataLoaded();
 	}
 };
 #endif
\ No newline at end of file
@@ -0,0 +1,114 @@
+#include "ThreadPool.h"
+
+
+thread_local ThreadPool* ThreadPool::currentPool = NULL; //initialization of static currentPool, NULL for threads outside of pools
+thread_local size_t ThreadPool::currentWorker = 0; //initialization of static currentWorker
+
+
+/**
+ * @brief Constructor of class, starts the worker threads.
+ * @param size_t numOfWorkers
+ * @param function<void()> workerStart
+ */
+ThreadPool::ThreadPool(size_t numOfWorkers, function<void()> workerStart) : workerStart(move(workerStart)) {
+	numOfWorkers = max(numOfWorkers, (size_t)1); //we need at least one worker
+	for (size_t i = 0; i < numOfWorkers; i++)
+		this->queues.push_back(make_unique<WorkerQueue>()); //create the queue of each worker
+	for (size_t i = 0; i < numOfWorkers; i++)
+		this->workers.emplace_back(&ThreadPool::workerLoop, this, i); //start each worker with its index
+}
+
+
+/**
+ * @brief Destructor of class, finishes the queued tasks and joins the workers.
+ */
+ThreadPool::~ThreadPool() {
+	this->shutdown(); //ensure that workers are joined
+}
+
+
+/**
+ * @brief Method for submitting a task to the pool.
+ * @param function<void()> task
+ */
+void ThreadPool::submit(function<void()> task) {
+	size_t queueIndex = (ThreadPool::currentPool == this) ? ThreadPool::currentWorker : this->nextQueue++ % this->queues.size(); //workers push to their own queue, others spread the tasks
+	{
+		lock_guard<mutex> lock(this->queues[queueIndex]->queueMutex); //lock the queue of worker
+		this->queues[queueIndex]->tasks.push_back(move(task)); //add the task to the queue
+		this->queuedTasks++; //increase the amount of queued tasks, under queue lock so it never drops below the tasks in queues
+	}
+	{
+		lock_guard<mutex> lock(this->sleepMutex); //lock the sleep mutex so a worker that is about to wait doesn't miss the wake up
+	}
+	this->sleepCondition.notify_one(); //wake up one idle worker
+}
+
+
+/**
+ * @brief Method for taking the next task, first from worker's own queue and then from the other queues, returns false if all queues are empty.
+ * @brief Owner takes tasks from the front of its queue and thieves take from the back, so they rarely contend on the same tasks.
+ * @param size_t workerIndex
+ * @param function<void()> task
+ */
+bool ThreadPool::popTask(size_t workerIndex, function<void()>& task) {
+	for (size_t i = 0; i < this->queues.size(); i++) { //iterate over the queues starting from our own
+		WorkerQueue& queue = *this->queues[(workerIndex + i) % this->queues.size()]; //represents the current queue
+		lock_guard<mutex> lock(queue.queueMutex); //lock the queue
+		if (queue.tasks.empty()) //if true there's nothing to take from this queue
+			continue;
+		if (i == 0) { //if true this is our own queue
+			task = move(queue.tasks.front()); //take the oldest task
+			queue.tasks.pop_front();
+		}
+		else { //else we steal from another worker
+			task = move(queue.tasks.back()); //take the newest task
+			queue.tasks.pop_back();
+		}
+		this->queuedTasks--; //decrease the amount of queued tasks
+		return true;
+	}
+	return false; //all queues are empty
+}
+
+
+/**
+ * @brief Method that represents the loop of each worker, runs tasks until the pool stops and the queues are empty.
+ * @param size_t workerIndex
+ */
+void ThreadPool::workerLoop(size_t workerIndex) {
+	ThreadPool::currentPool = this; //save the pool of this worker
+	ThreadPool::currentWorker = workerIndex; //save the index of this worker
+	if (this->workerStart) //if true we prepare the worker thread, for example lower its priority
+		this->workerStart();
+	function<void()> task; //represents the current task
+	while (true) {
+		if (this->popTask(workerIndex, task)) { //if true we have a task to run
+			task(); //run the task
+			task = nullptr; //release the task resources before waiting
+			continue;
+		}
+		unique_lock<mutex> lock(this->sleepMutex); //lock the sleep mutex for waiting
+		this->sleepCondition.wait(lock, [this]() { return this->queuedTasks > 0 || this->isStopping; }); //wait until there's a task or the pool stops
+		if (this->isStopping && this->queuedTasks == 0) //if true the pool stopped and there's nothing left to run
+			break;
+	}
+	ThreadPool::currentPool = NULL; //this thread is no longer a worker
+}
+
+
+/**
+ * @brief Method for stopping the pool, workers finish the queued tasks and are joined.
+ */
+void ThreadPool::shutdown() {
+	{
+		lock_guard<mutex> lock(this->sleepMutex); //lock the sleep mutex so no worker misses the stop
+		this->isStopping = true; //set isStopping flag
+	}
+	this->sleepCondition.notify_all(); //wake up all workers
+	for (thread& worker : this->workers) { //iterate over the workers
+		if (worker.joinable()) //if true the worker wasn't joined yet
+			worker.join(); //wait for worker to exit
+	}
+	this->workers.clear(); //all workers are joined
+}
\ No newline at end of file
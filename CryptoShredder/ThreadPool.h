@@ -0,0 +1,55 @@
+#ifndef _ThreadPool_H
+#define _ThreadPool_H
+#define _CRT_SECURE_NO_WARNINGS
+#include <iostream>
+#include <string.h>
+#include <vector>
+#include <deque>
+#include <memory>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+
+using namespace std;
+
+/**
+ * @brief Class that represents a fixed-size pool of worker threads with work stealing.
+ * @brief Each worker has its own task queue, an idle worker takes tasks from the other queues so no worker stays idle while work remains.
+ * @brief Tasks submitted from a worker go to its own queue, tasks submitted from other threads are spread between the queues.
+ * @brief Tasks run only on the worker that took them and don't start threads, so the size of pool bounds the threads of its tasks.
+ */
+class ThreadPool {
+private:
+	/**
+	 * @brief Struct that represents the task queue of one worker.
+	 */
+	struct WorkerQueue {
+		deque<function<void()>> tasks; //represents the queued tasks of worker
+		mutex queueMutex; //mutex for thread-safe access to tasks
+	};
+
+	vector<unique_ptr<WorkerQueue>> queues; //represents the task queue of each worker
+	vector<thread> workers; //represents the worker threads
+	atomic<size_t> queuedTasks = 0; //represents the amount of tasks waiting in the queues
+	atomic<size_t> nextQueue = 0; //represents the queue for next task submitted from outside of pool
+	atomic<bool> isStopping = false; //flag for indicating that workers should exit once the queues are empty
+	mutex sleepMutex; //mutex for idle workers
+	condition_variable sleepCondition; //condition for waking idle workers
+	function<void()> workerStart; //represents the function each worker runs once before taking tasks, can be empty
+	static thread_local ThreadPool* currentPool; //represents the pool of current worker thread
+	static thread_local size_t currentWorker; //represents the index of current worker thread
+	void workerLoop(size_t workerIndex);
+	bool popTask(size_t workerIndex, function<void()>& task);
+
+public:
+	ThreadPool(size_t numOfWorkers = max(thread::hardware_concurrency(), 1u), function<void()> workerStart = nullptr);
+	virtual ~ThreadPool();
+	ThreadPool(const ThreadPool&) = delete; //prevent copy
+	void operator=(const ThreadPool&) = delete; //prevent assignment
+	void submit(function<void()> task);
+	void shutdown();
+	size_t getNumOfWorkers() { return this->queues.size(); }
+};
+#endif
\ No newline at end of file
@@ -0,0 +1,36 @@
+#include "ThreadPriority.h"
+#include <algorithm>
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#elif defined(__linux__)
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <sys/resource.h>
+#endif
+
+
+/**
+ * @brief Function for lowering the priority of current thread, returns true if all priorities were set.
+ * @brief On Linux sets the thread's ioprio class and level with ioprio_set and its nice value with setpriority.
+ * @brief On Windows the idle class uses the thread background mode that lowers both CPU and I/O priority,
+ * @brief the best effort class lowers only the CPU priority.
+ * @param IOClass ioClass
+ * @param int ioLevel
+ * @param int niceValue
+ */
+bool ThreadPriority::SetBackground(IOClass ioClass, int ioLevel, int niceValue) {
+#ifdef _WIN32
+	if (ioClass == ThreadPriority::Idle) //if true we use background mode for CPU and I/O
+		return SetThreadPriority(GetCurrentThread(), THREAD_MODE_BACKGROUND_BEGIN) != 0;
+	return SetThreadPriority(GetCurrentThread(), (niceValue >= 10) ? THREAD_PRIORITY_LOWEST : THREAD_PRIORITY_BELOW_NORMAL) != 0; //lower the CPU priority
+#elif defined(__linux__)
+	const int ioprioClassShift = 13; //represents the shift of class in ioprio value
+	const int ioprioWhoProcess = 1; //represents IOPRIO_WHO_PROCESS, with id zero it applies to calling thread
+	int ioprio = (ioClass << ioprioClassShift) | ((ioClass == ThreadPriority::BestEffort) ? clamp(ioLevel, 0, 7) : 0); //build the ioprio value
+	bool result = syscall(SYS_ioprio_set, ioprioWhoProcess, 0, ioprio) == 0; //set the I/O priority of thread
+	return setpriority(PRIO_PROCESS, (id_t)syscall(SYS_gettid), clamp(niceValue, 0, 19)) == 0 && result; //set the nice value of thread, Linux applies it per thread
+#else
+	return false; //not supported on this platform
+#endif
+}
\ No newline at end of file
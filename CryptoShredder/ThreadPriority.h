@@ -0,0 +1,24 @@
+#ifndef _ThreadPriority_H
+#define _ThreadPriority_H
+#define _CRT_SECURE_NO_WARNINGS
+#include <iostream>
+#include <string.h>
+
+using namespace std;
+
+/**
+ * @brief Class for lowering the I/O and CPU priority of current thread, used by workers of background jobs.
+ */
+class ThreadPriority {
+public:
+	/**
+	 * @brief Enum that represents the I/O scheduling class, values match the Linux IOPRIO_CLASS constants.
+	 */
+	enum IOClass {
+		BestEffort = 2, //I/O is served after normal I/O of same level, level 0 is highest and 7 is lowest
+		Idle = 3 //I/O is served only when no other process needs the disk
+	};
+
+	static bool SetBackground(IOClass ioClass, int ioLevel, int niceValue);
+};
+#endif
\ No newline at end of file
@@ -0,0 +1,55 @@
+#include "Throttle.h"
+
+
+/**
+ * @brief Method for setting the rate of bucket, zero disables the throttle. Bucket starts full with a quarter second of tokens.
+ * @param size_t bytesPerSecond
+ */
+void Throttle::setRate(size_t bytesPerSecond) {
+	lock_guard<mutex> lock(this->throttleMutex); //lock the mutex for bucket
+	this->rate = (double)bytesPerSecond; //set the rate of bucket
+	this->burst = this->rate / 4; //allow bursts of a quarter second
+	this->tokens = this->burst; //start with full bucket
+	this->lastRefill = chrono::steady_clock::now(); //start refilling from now
+	this->isReleased = false; //reset isReleased flag
+}
+
+
+/**
+ * @brief Method for getting the rate of bucket in bytes per second.
+ */
+size_t Throttle::getRate() {
+	lock_guard<mutex> lock(this->throttleMutex); //lock the mutex for bucket
+	return (size_t)this->rate;
+}
+
+
+/**
+ * @brief Method for taking bytes from the bucket, waits until the bytes are covered by the rate or the throttle is released.
+ * @param size_t bytes
+ */
+void Throttle::acquire(size_t bytes) {
+	unique_lock<mutex> lock(this->throttleMutex); //lock the mutex for bucket
+	if (this->rate <= 0 || this->isReleased) //if true the throttle is disabled or released
+		return;
+	chrono::steady_clock::time_point now = chrono::steady_clock::now(); //represents the current time
+	this->tokens = min(this->burst, this->tokens + this->rate * chrono::duration<double>(now - this->lastRefill).count()); //add the tokens since last refill
+	this->lastRefill = now; //save the refill time
+	this->tokens -= (double)bytes; //take the bytes, negative tokens are a debt
+	if (this->tokens >= 0) //if true the bucket covered the bytes
+		return;
+	chrono::steady_clock::time_point deadline = now + chrono::duration_cast<chrono::steady_clock::duration>(chrono::duration<double>(-this->tokens / this->rate)); //represents the time the debt is paid
+	this->releaseCondition.wait_until(lock, deadline, [this]() { return this->isReleased; }); //wait for the debt or release
+}
+
+
+/**
+ * @brief Method for releasing all waiters and disabling the throttle until the rate is set again.
+ */
+void Throttle::release() {
+	{
+		lock_guard<mutex> lock(this->throttleMutex); //lock the mutex for bucket
+		this->isReleased = true; //set isReleased flag
+	}
+	this->releaseCondition.notify_all(); //wake up all waiters
+}
\ No newline at end of file
@@ -0,0 +1,33 @@
+#ifndef _Throttle_H
+#define _Throttle_H
+#define _CRT_SECURE_NO_WARNINGS
+#include <iostream>
+#include <string.h>
+#include <chrono>
+#include <mutex>
+#include <condition_variable>
+
+using namespace std;
+
+/**
+ * @brief Class that represents a token bucket that caps the bandwidth of a job, shared by all its workers.
+ * @brief Each acquire takes its bytes from the bucket, if the bucket runs dry the bytes become a debt that the caller pays by waiting,
+ * @brief so concurrent callers are paced in the order they asked. Release wakes all waiters, used when job is canceled.
+ */
+class Throttle {
+private:
+	double rate = 0; //represents the rate of bucket in bytes per second, zero for unlimited
+	double burst = 0; //represents the maximal amount of tokens in bucket
+	double tokens = 0; //represents the current amount of tokens, negative when callers are in debt
+	chrono::steady_clock::time_point lastRefill; //represents the last time we added tokens
+	bool isReleased = false; //flag for indicating that waiters should stop waiting
+	mutex throttleMutex; //mutex for thread-safe access to bucket
+	condition_variable releaseCondition; //condition for waking waiters on release
+
+public:
+	void setRate(size_t bytesPerSecond);
+	size_t getRate();
+	void acquire(size_t bytes);
+	void release();
+};
+#endif
\ No newline at end of file
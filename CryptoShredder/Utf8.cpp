@@ -0,0 +1,223 @@
+#include "Utf8.h"
+#include <bit>
+
+
+/**
+ * @brief Function for decoding one code point, returns the length of its sequence or 0 if the sequence is invalid.
+ * @brief Overlong sequences and code points above U+10FFFF are invalid, surrogates are valid only if allowSurrogates is true.
+ * @param unsigned char* str
+ * @param size_t size
+ * @param char32_t codePoint
+ * @param bool allowSurrogates
+ */
+size_t Utf8::Decode(const unsigned char* str, size_t size, char32_t& codePoint, bool allowSurrogates) {
+	unsigned char lead = str[0]; //represents the first byte of sequence
+	size_t length = 0; //represents the length of sequence
+	char32_t minCodePoint = 0; //represents the smallest code point of this length, smaller ones are overlong
+	if (lead < 0x80) { //single-byte characters
+		codePoint = lead;
+		return 1;
+	}
+	else if (lead >= 0xC2 && lead <= 0xDF) { //2-byte characters, 0xC0 and 0xC1 can only start overlong sequences
+		length = 2;
+		codePoint = lead & 0x1F;
+		minCodePoint = 0x80;
+	}
+	else if ((lead & 0xF0) == 0xE0) { //3-byte characters
+		length = 3;
+		codePoint = lead & 0x0F;
+		minCodePoint = 0x800;
+	}
+	else if (lead >= 0xF0 && lead <= 0xF4) { //4-byte characters, larger leads are above U+10FFFF
+		length = 4;
+		codePoint = lead & 0x07;
+		minCodePoint = 0x10000;
+	}
+	else //continuation byte or invalid lead
+		return 0;
+	if (size < length) //if true the sequence is cut
+		return 0;
+	for (size_t i = 1; i < length; i++) { //add the bits of each continuation byte
+		if ((str[i] & 0xC0) != 0x80) //if true the byte isn't a continuation byte
+			return 0;
+		codePoint = (codePoint << 6) | (str[i] & 0x3F);
+	}
+	if (codePoint < minCodePoint || codePoint > 0x10FFFF) //if true the sequence is overlong or out of range
+		return 0;
+	if (!allowSurrogates && codePoint >= 0xD800 && codePoint <= 0xDFFF) //if true the sequence is a surrogate, valid only in WTF-8
+		return 0;
+	return length;
+}
+
+
+/**
+ * @brief Function for appending the sequence of code point to result, surrogates are encoded like other code points.
+ * @param char32_t codePoint
+ * @param string result
+ */
+void Utf8::Encode(char32_t codePoint, string& result) {
+	if (codePoint < 0x80) //single-byte characters
+		result.push_back((char)codePoint);
+	else if (codePoint < 0x800) { //2-byte characters
+		result.push_back((char)(0xC0 | (codePoint >> 6)));
+		result.push_back((char)(0x80 | (codePoint & 0x3F)));
+	}
+	else if (codePoint < 0x10000) { //3-byte characters
+		result.push_back((char)(0xE0 | (codePoint >> 12)));
+		result.push_back((char)(0x80 | ((codePoint >> 6) & 0x3F)));
+		result.push_back((char)(0x80 | (codePoint & 0x3F)));
+	}
+	else { //4-byte characters
+		result.push_back((char)(0xF0 | (codePoint >> 18)));
+		result.push_back((char)(0x80 | ((codePoint >> 12) & 0x3F)));
+		result.push_back((char)(0x80 | ((codePoint >> 6) & 0x3F)));
+		result.push_back((char)(0x80 | (codePoint & 0x3F)));
+	}
+}
+
+
+/**
+ * @brief Function for finding the length of ASCII run at start of str, checks 16 bytes at a time with SSE2.
+ * @param char* str
+ * @param size_t size
+ */
+size_t Utf8::AsciiPrefix(const char* str, size_t size) {
+	size_t i = 0; //represents the length of ASCII run
+#if defined(_M_X64) || defined(__SSE2__)
+	for (; i + 16 <= size; i += 16) { //check each block of 16 bytes
+		int mask = _mm_movemask_epi8(_mm_loadu_si128((const __m128i*)(str + i))); //collect the high bit of each byte, only non-ASCII bytes have it
+		if (mask != 0) //if true the block has a non-ASCII byte
+			return i + countr_zero((unsigned)mask);
+	}
+#endif
+	while (i < size && (unsigned char)str[i] < 0x80) //check the bytes that are left
+		i++;
+	return i;
+}
+
+
+/**
+ * @brief Function for finding the length of valid UTF-8 at start of str, returns the size of str if it's all valid.
+ * @param string_view str
+ */
+size_t Utf8::ValidPrefix(string_view str) {
+	const unsigned char* data = (const unsigned char*)str.data(); //represents the bytes of str
+	size_t i = 0; //represents the length of valid prefix
+	while (i < str.size()) { //validate until the end of str
+		i += Utf8::AsciiPrefix(str.data() + i, str.size() - i); //skip the ASCII run
+		if (i == str.size()) //if true str ends with ASCII
+			break;
+		char32_t codePoint; //represents the decoded code point
+		size_t length = Utf8::Decode(data + i, str.size() - i, codePoint, false); //decode the non-ASCII code point
+		if (length == 0) //if true the sequence is invalid
+			return i;
+		i += length;
+	}
+	return i;
+}
+
+
+/**
+ * @brief Function for converting a native path to valid UTF-8 for display, valid strings are copied as they are.
+ * @param string_view str
+ */
+string Utf8::ToDisplay(string_view str) {
+	size_t i = Utf8::ValidPrefix(str); //represents the position of first invalid sequence
+	string result(str.substr(0, i)); //represents the displayed string, starts with the valid prefix
+	if (i == str.size()) //if true str is valid UTF-8
+		return result;
+	const unsigned char* data = (const unsigned char*)str.data(); //represents the bytes of str
+	while (i < str.size()) { //replace each invalid sequence
+		size_t ascii = Utf8::AsciiPrefix(str.data() + i, str.size() - i); //represents the length of ASCII run
+		result.append(str.data() + i, ascii); //copy the ASCII run
+		i += ascii;
+		if (i == str.size()) //if true str ends with ASCII
+			break;
+		char32_t codePoint; //represents the decoded code point
+		size_t length = Utf8::Decode(data + i, str.size() - i, codePoint, false); //decode the non-ASCII code point
+		if (length == 0) { //if true the byte starts no valid sequence, we replace it and continue from next byte
+			Utf8::Encode(Replacement, result);
+			i++;
+		}
+		else { //else we copy the valid sequence
+			result.append(str.data() + i, length);
+			i += length;
+		}
+	}
+	return result;
+}
+
+
+/**
+ * @brief Function for cutting str to at most maxSize bytes without splitting a multi-byte sequence.
+ * @param string_view str
+ * @param size_t maxSize
+ */
+string_view Utf8::Truncate(string_view str, size_t maxSize) {
+	if (str.size() <= maxSize) //if true str is short enough
+		return str;
+	size_t end = maxSize; //represents the end of cut, moved back to the start of sequence it splits
+	while (end > 0 && ((unsigned char)str[end] & 0xC0) == 0x80)
+		end--;
+	return str.substr(0, end);
+}
+
+
+/**
+ * @brief Function for converting WTF-8 to wide string, UTF-16 if wchar_t has 16 bits and UTF-32 otherwise.
+ * @brief Invalid bytes are replaced with U+FFFD.
+ * @param string_view str
+ */
+wstring Utf8::ToWide(string_view str) {
+	const unsigned char* data = (const unsigned char*)str.data(); //represents the bytes of str
+	wstring result; //represents the wide string
+	result.reserve(str.size()); //wide string has at most a character for each byte
+	size_t i = 0; //represents the position in str
+	while (i < str.size()) { //convert until the end of str
+		size_t ascii = Utf8::AsciiPrefix(str.data() + i, str.size() - i); //represents the length of ASCII run
+		result.append(data + i, data + i + ascii); //widen the ASCII run
+		i += ascii;
+		if (i == str.size()) //if true str ends with ASCII
+			break;
+		char32_t codePoint; //represents the decoded code point
+		size_t length = Utf8::Decode(data + i, str.size() - i, codePoint, true); //decode the non-ASCII code point, surrogates come from Windows names
+		if (length == 0) { //if true the byte starts no valid sequence
+			codePoint = Replacement;
+			length = 1;
+		}
+		if (sizeof(wchar_t) == 2 && codePoint >= 0x10000) { //if true we need a surrogate pair
+			codePoint -= 0x10000;
+			result.push_back((wchar_t)(0xD800 | (codePoint >> 10))); //high surrogate
+			result.push_back((wchar_t)(0xDC00 | (codePoint & 0x3FF))); //low surrogate
+		}
+		else
+			result.push_back((wchar_t)codePoint);
+		i += length;
+	}
+	return result;
+}
+
+
+/**
+ * @brief Function for converting wide string to WTF-8, surrogate pairs are joined and unpaired surrogates are kept as 3-byte sequences.
+ * @param wstring_view wstr
+ */
+string Utf8::FromWide(wstring_view wstr) {
+	string result; //represents the WTF-8 string
+	result.reserve(wstr.size()); //most names are ASCII
+	for (size_t i = 0; i < wstr.size(); i++) { //convert each character
+		char32_t codePoint = (char32_t)wstr[i]; //represents the current code point
+		if (codePoint < 0x80) { //if true the character is ASCII
+			result.push_back((char)codePoint);
+			continue;
+		}
+		if (sizeof(wchar_t) == 2 && codePoint >= 0xD800 && codePoint <= 0xDBFF && i + 1 < wstr.size() && (char32_t)wstr[i + 1] >= 0xDC00 && (char32_t)wstr[i + 1] <= 0xDFFF) { //if true we join the surrogate pair
+			codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + ((char32_t)wstr[i + 1] - 0xDC00);
+			i++;
+		}
+		else if (codePoint > 0x10FFFF) //if true the character is out of range
+			codePoint = Replacement;
+		Utf8::Encode(codePoint, result);
+	}
+	return result;
+}
\ No newline at end of file
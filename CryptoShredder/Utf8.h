@@ -0,0 +1,35 @@
+#ifndef _Utf8_H
+#define _Utf8_H
+#define _CRT_SECURE_NO_WARNINGS
+#include <iostream>
+#include <string.h>
+#include <string_view>
+#include <cstdint>
+#if defined(_M_X64) || defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+using namespace std;
+
+/**
+ * @brief Class for validating and transcoding UTF-8 strings, the engine keeps native byte paths and only display and Windows API calls convert them.
+ * @brief Runs of ASCII are skipped 16 bytes at a time with SSE2 and only the bytes after a non-ASCII byte are decoded one code point at a time.
+ * @brief Wide conversions use WTF-8, so an unpaired surrogate of a Windows name survives the round trip and a path that came from Windows opens again.
+ * @brief Strings for display are strict UTF-8, invalid sequences and surrogates are replaced with U+FFFD.
+ */
+class Utf8 {
+private:
+	static constexpr char32_t Replacement = 0xFFFD; //represents the replacement character for invalid sequences
+	static size_t Decode(const unsigned char* str, size_t size, char32_t& codePoint, bool allowSurrogates);
+	static void Encode(char32_t codePoint, string& result);
+
+public:
+	static size_t AsciiPrefix(const char* str, size_t size);
+	static size_t ValidPrefix(string_view str);
+	static bool Validate(string_view str) { return ValidPrefix(str) == str.size(); }
+	static string ToDisplay(string_view str);
+	static string_view Truncate(string_view str, size_t maxSize);
+	static wstring ToWide(string_view str);
+	static string FromWide(wstring_view wstr);
+};
+#endif
\ No newline at end of file